@@ -0,0 +1,178 @@
+// Batch mode: count triangles for many graphs in one process.
+//
+// GrB_init, the creation of the graph matrices and the process startup are
+// paid once for the whole manifest instead of once per graph.  Graphs are
+// loaded through a double-buffered pipeline: while the graph in one slot is
+// being counted, a loader thread reads the next edge list into the other slot.
+// The loader thread only parses the file into tuples, on a single core that
+// the counting leaves free while it runs; the matrix is built from the tuples
+// on the main thread, between two graphs, so no GraphBLAS call runs while a
+// graph is being timed.  Each slot keeps its matrix and its tuple buffers,
+// which only grow, across graphs.  The GraphBLAS Sauna workspace is likewise
+// kept from one graph to the next since GrB_finalize is not called in between.
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "batch.h"
+#include "../bench/json.h"
+#include "../edgelist/edge_list.h"
+#include "../mytricount/mytricount.h"
+#include "../timer/simple_timer.h"
+
+#define MAX_PATH_LEN 255
+
+// One buffer of the loading pipeline
+typedef struct {
+    char path[MAX_PATH_LEN];
+    GrB_Matrix graph;   // reused for every graph loaded into this slot
+    edge_list edges;    // tuple buffers, reused for every graph
+    double load_time;
+    bool ok;            // false if the graph could not be loaded
+} graph_slot;
+
+// Read the edge list in slot->path into the tuple buffers of the slot.  Only
+// plain C, so that it can run next to the counting of another graph.
+static void read_slot(graph_slot* slot) {
+    double tic[2];
+    simple_tic(tic);
+    slot->ok = edge_list_read(&slot->edges, slot->path, false);
+    slot->load_time = simple_toc(tic);
+}
+
+static void* read_slot_thread(void* arg) {
+    read_slot((graph_slot*) arg);
+    return NULL;
+}
+
+// Build the symmetric graph of the slot from the tuples read, on all threads
+static void build_slot(graph_slot* slot) {
+    if (!slot->ok) {
+        return;
+    }
+    double tic[2];
+    simple_tic(tic);
+    slot->ok = edge_list_build(slot->graph, &slot->edges) == GrB_SUCCESS;
+    slot->load_time += simple_toc(tic);
+}
+
+// Count the triangles with every method on nthreads threads and write one
+// JSON object
+static void count_slot(graph_slot* slot, char methods[][255], int nmethods, int nthreads) {
+    printf("{\"graph\": ");
+    json_print_string(stdout, slot->path);
+    if (!slot->ok) {
+        printf(", \"error\": \"failed to load graph\"}\n");
+        fflush(stdout);
+        return;
+    }
+    printf(", \"load_time\": %f, \"nthreads\": %d", slot->load_time, nthreads);
+
+    double timer[3];
+    int64_t res = 0, nwedge = 0;
+    int max_threads;
+    GxB_get(GxB_NTHREADS, &max_threads);
+    GxB_set(GxB_NTHREADS, nthreads);
+
+    printf(", \"methods\": {");
+    for (int i = 1; i <= nmethods; ++i) {
+        int method = i % nmethods;
+        // the wedges are counted once, alongside the first method
+        GrB_Info info = mytricount(&res, (i == 1) ? &nwedge : NULL, method, slot->graph, timer);
+
+        printf("%s\"%s\": ", (i == 1) ? "" : ", ", methods[method]);
+        if (info == GrB_SUCCESS) {
+            printf("{\"ntri\": %ld, \"time\": %f}", res, timer[0] + timer[1]);
+        } else {
+            printf("{\"error\": %d}", info);
+        }
+    }
+    GxB_set(GxB_NTHREADS, max_threads);
+    printf("}, \"nwedge\": %ld}\n", nwedge);
+    fflush(stdout);
+}
+
+int run_batch(const char* manifest_path, char methods[][255], int nmethods, GrB_Index n) {
+    FILE* manifest = fopen(manifest_path, "r");
+    if (manifest == NULL) {
+        fprintf(stderr, "cannot open manifest %s\n", manifest_path);
+        return 1;
+    }
+
+    // Read all paths from the manifest
+    char** paths = NULL;
+    size_t npaths = 0, max_paths = 0;
+    char* line_buf = NULL;
+    size_t buf_size = 0;
+    while (getline(&line_buf, &buf_size, manifest) != -1) {
+        line_buf[strcspn(line_buf, "\r\n")] = 0;
+        if (line_buf[0] == '\0' || line_buf[0] == '#') {
+            continue;
+        }
+        if (npaths == max_paths) {
+            max_paths = max_paths == 0 ? 16 : 2 * max_paths;
+            paths = realloc(paths, max_paths * sizeof(char*));
+            assert(paths != NULL);
+        }
+        paths[npaths++] = strdup(line_buf);
+    }
+    free(line_buf);
+    fclose(manifest);
+
+    // Create both slots of the pipeline once
+    graph_slot slots[2];
+    memset(slots, 0, sizeof(slots));
+    for (int s = 0; s < 2; ++s) {
+        GrB_Info info = GrB_Matrix_new(&slots[s].graph, GrB_UINT32, n, n);
+        assert(info == GrB_SUCCESS && "GraphBlas: failed to construct matrix\n");
+    }
+
+    int max_threads;
+    GxB_get(GxB_NTHREADS, &max_threads);
+
+    if (npaths > 0) {
+        strncpy(slots[0].path, paths[0], MAX_PATH_LEN - 1);
+        read_slot(&slots[0]);
+    }
+
+    for (size_t g = 0; g < npaths; ++g) {
+        graph_slot* current = &slots[g % 2];
+        graph_slot* next = &slots[(g + 1) % 2];
+
+        // Nothing else runs while the matrix is built on all threads
+        build_slot(current);
+
+        // Read the next graph while the current one is being counted, and
+        // leave the reader a core of its own
+        pthread_t loader;
+        bool loading = false;
+        if (g + 1 < npaths) {
+            strncpy(next->path, paths[g + 1], MAX_PATH_LEN - 1);
+            loading = (pthread_create(&loader, NULL, read_slot_thread, next) == 0);
+            if (!loading) {
+                read_slot(next);
+            }
+        }
+
+        int nthreads = (loading && max_threads > 1) ? max_threads - 1 : max_threads;
+        count_slot(current, methods, nmethods, nthreads);
+
+        if (loading) {
+            pthread_join(loader, NULL);
+        }
+    }
+
+    for (int s = 0; s < 2; ++s) {
+        GrB_free(&slots[s].graph);
+        edge_list_free(&slots[s].edges);
+    }
+    for (size_t g = 0; g < npaths; ++g) {
+        free(paths[g]);
+    }
+    free(paths);
+
+    return 0;
+}
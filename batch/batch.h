@@ -0,0 +1,13 @@
+#pragma once
+
+#include "../deps/GraphBLAS/Demo/Include/demos.h"
+
+// Count the triangles in every graph listed in a manifest file (one edge list
+// path per line), in a single process.  Results are written to stdout as JSON
+// Lines, one object per graph.
+int run_batch(
+    const char* manifest_path,  // file with one input path per line
+    char methods[][255],        // names of the mytricount methods
+    int nmethods,               // number of mytricount methods
+    GrB_Index n                 // dimension of every graph matrix
+);
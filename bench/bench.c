@@ -0,0 +1,461 @@
+// Benchmark driver: time the triangle counting methods on a set of graphs.
+//
+// Every graph is loaded `warmup + reps` times and every method is run
+// `warmup + reps` times on it.  The warmup runs are not recorded; they fault
+// in the matrices and fill the GraphBLAS arena and Sauna workspace, which
+// otherwise land on the first sample.  For the timed runs the min, median,
+// 95th percentile and standard deviation of each phase (load, preprocessing,
+// multiply and reduce) are reported, as one JSON document on stdout.  The
+// "total" phase is multiply + reduce, the "used time" printed by ./main.
+// "peak_bytes" is the most memory GraphBLAS had allocated during a timed run
+// of the method, beyond the graph itself (GxB_MEMORY_PEAK).
+//
+// Usage: ./tricount_bench [-w warmup] [-r reps] [-m method,...]
+//                         [-s max_threads] [-o tables.md] [-t trace.json]
+//                         [-p] [-c baseline.json [-T threshold]] [-R]
+//                         graph ...
+//
+// With -s, every method is timed with 1, 2, 4, ... max_threads threads
+// instead (see sweep.c); -s 0 sweeps up to the number of cores.
+//
+// With -t, the trace of the GraphBLAS internal phases of all runs is written
+// to a Chrome trace file.  This needs GraphBLAS built with -DGBTRACE=1.
+//
+// With -p, the hardware counters (cycles, instructions, LLC, dTLB and branch
+// misses) of each phase are summed over the timed runs and reported with the
+// IPC and the misses per thousand instructions.  Counters the machine does
+// not provide are null; if there are none at all the benchmark runs without.
+//
+// With -c, every result is compared with the same method and graph in a
+// baseline written by an earlier run (see compare.c).  The regressions,
+// slowdowns of the median beyond the -T threshold (default 5%) that are
+// significant, or changed triangle counts, are listed on stderr and make the
+// exit status 2.
+//
+// With -R, the STREAM triad bandwidth of the machine is measured once, and
+// for each method the bytes its multiplies move are estimated from the
+// entries of their operands, masks and results and their flops (see
+// roofline.c).  The achieved bandwidth of the multiply phase is reported
+// with the percentage of the STREAM bandwidth it reaches.
+//
+// A graph is an edge list in the same format as for ./main.  Its matrix has
+// dimension (largest vertex id + 1), not the fixed MAX_GRAPH_SIZE of ./main.
+// A graph "gen:spec" is generated in memory instead (see gen/graph_gen.h),
+// and the time to generate it is reported as its load time.
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "json.h"
+#include "stats.h"
+#include "../edgelist/edge_list.h"
+#include "../gen/graph_gen.h"
+#include "../mytricount/mytricount.h"
+#include "../timer/simple_timer.h"
+
+#define DEFAULT_WARMUP 1
+#define DEFAULT_REPS 5
+#define HUGE_PAGE_THRESHOLD ((int64_t) 64 << 20)
+#define GEN_PREFIX "gen:"
+#define DEFAULT_THRESHOLD 0.05
+#define EXIT_REGRESSED 2
+
+const char* METHODS[NMETHODS] = {
+    "Naive",
+    "Burkhardt",
+    "Cohen",
+    "Sandia",
+    "Sandia2",
+    "SandiaDot",
+    "SandiaDot2",
+    "Forward"
+};
+
+const char* PHASE_NAMES[NPHASES] = {
+    "multiply",
+    "reduce",
+    "preprocessing",
+    "total"
+};
+
+// Read the edge list in path and build the symmetric graph from it.  The
+// edge buffers are kept in edges so that repeated loads reuse them.
+static GrB_Info load_graph(GrB_Matrix* graph, edge_list* edges, const char* path) {
+    if (!edge_list_read(edges, path, false)) {
+        return GrB_INVALID_VALUE;
+    }
+
+    GrB_Info info = GrB_Matrix_new(graph, GrB_UINT32, edges->n, edges->n);
+    if (info != GrB_SUCCESS) {
+        return info;
+    }
+    info = edge_list_build(*graph, edges);
+    if (info != GrB_SUCCESS) {
+        GrB_free(graph);
+    }
+    return info;
+}
+
+// Time warmup + reps loads of the graph; the matrix of the last one is kept
+static GrB_Info bench_load(GrB_Matrix* graph, const char* path, const bench_options* opts,
+    double* samples) {
+    edge_list edges;
+    memset(&edges, 0, sizeof(edges));
+    GrB_Info info = GrB_SUCCESS;
+
+    for (int r = 0; r < opts->warmup + opts->reps && info == GrB_SUCCESS; ++r) {
+        GrB_free(graph);
+        double tic[2];
+        simple_tic(tic);
+        if (strncmp(path, GEN_PREFIX, strlen(GEN_PREFIX)) == 0) {
+            info = gen_graph(graph, path + strlen(GEN_PREFIX), GEN_DEFAULT_SEED);
+        } else {
+            info = load_graph(graph, &edges, path);
+        }
+        double time = simple_toc(tic);
+        if (r >= opts->warmup) {
+            samples[r - opts->warmup] = time;
+        }
+    }
+
+    edge_list_free(&edges);
+    return info;
+}
+
+static void print_phase(const char* name, const double* samples, int n, bool first) {
+    bench_stats stats;
+    bench_stats_compute(&stats, samples, n);
+    printf("%s\"%s\": ", first ? "" : ", ", name);
+    bench_stats_print_json(stdout, &stats);
+}
+
+// counts += sample, where a count missing from either is missing
+static void add_counts(perf_sample* counts, const perf_sample* sample) {
+    for (int c = 0; c < PERF_NCOUNTERS; ++c) {
+        bool missing = counts->count[c] < 0 || sample->count[c] < 0;
+        counts->count[c] = missing ? -1 : counts->count[c] + sample->count[c];
+    }
+}
+
+GrB_Info bench_run_method(int64_t* ntri, int64_t* peak_bytes, perf_sample* counters, int method,
+    GrB_Matrix graph, const bench_options* opts, double* samples[NPHASES]) {
+    GrB_Info info = GrB_SUCCESS;
+    *peak_bytes = 0;
+    memset(counters, 0, PERF_NPHASES * sizeof(perf_sample));
+
+    for (int r = 0; r < opts->warmup + opts->reps && info == GrB_SUCCESS; ++r) {
+        // the graph and anything else already allocated is not counted
+        int64_t inuse, peak;
+        GxB_get(GxB_MEMORY_INUSE, &inuse);
+        GxB_set(GxB_MEMORY_PEAK, 0);
+
+        double timer[3];
+        info = mytricount(ntri, NULL, method, graph, timer);
+        GxB_get(GxB_MEMORY_PEAK, &peak);
+        if (r >= opts->warmup) {
+            int k = r - opts->warmup;
+            if (peak - inuse > *peak_bytes) *peak_bytes = peak - inuse;
+            if (opts->counters) {
+                perf_sample phases[PERF_NPHASES];
+                perf_phases_get(phases);
+                for (int p = 0; p < PERF_NPHASES; ++p) {
+                    add_counts(&counters[p], &phases[p]);
+                }
+            }
+            samples[PHASE_MULTIPLY][k] = timer[0];
+            samples[PHASE_REDUCE][k] = timer[1];
+            samples[PHASE_PREP][k] = timer[2];
+            samples[PHASE_TOTAL][k] = timer[0] + timer[1];
+        }
+    }
+    return info;
+}
+
+void bench_print_phases(double* samples[NPHASES], int reps) {
+    for (int p = 0; p < NPHASES; ++p) {
+        print_phase(PHASE_NAMES[p], samples[p], reps, false);
+    }
+}
+
+void bench_print_counters(const perf_sample* counters, const bench_options* opts) {
+    if (!opts->counters) {
+        return;
+    }
+    // the perf phases are in the same order as the timed phases
+    printf(", \"counters\": {");
+    for (int p = 0; p < PERF_NPHASES; ++p) {
+        printf("%s\"%s\": ", p == 0 ? "" : ", ", PHASE_NAMES[p]);
+        perf_sample_print_json(stdout, &counters[p]);
+    }
+    printf("}");
+}
+
+// Run one method and write its JSON object
+static void bench_method(const char* path, int method, GrB_Matrix graph,
+    const bench_options* opts, double* samples[NPHASES]) {
+    int64_t ntri = 0, peak_bytes = 0;
+    perf_sample counters[PERF_NPHASES];
+    GrB_Info info = bench_run_method(&ntri, &peak_bytes, counters, method, graph, opts,
+        samples);
+    if (info != GrB_SUCCESS) {
+        printf("{\"error\": %d}", info);
+        return;
+    }
+
+    printf("{\"ntri\": %ld, \"peak_bytes\": %ld", ntri, peak_bytes);
+    bench_print_phases(samples, opts->reps);
+    bench_print_counters(counters, opts);
+    if (opts->baseline != NULL) {
+        bench_compare_method(opts->baseline, path, METHODS[method], ntri,
+            samples[PHASE_TOTAL], opts->reps);
+    }
+    if (opts->roofline) {
+        bench_traffic traffic;
+        bench_stats multiply;
+        bench_stats_compute(&multiply, samples[PHASE_MULTIPLY], opts->reps);
+        if (bench_traffic_measure(&traffic, method, graph) == GrB_SUCCESS) {
+            bench_print_roofline(&traffic, multiply.median, opts->bandwidth);
+        } else {
+            printf(", \"roofline\": null");
+        }
+    }
+    printf("}");
+}
+
+static void bench_graph(const char* path, const bench_options* opts,
+    double* samples[NPHASES], bool first) {
+    fprintf(stderr, "benchmarking %s\n", path);
+    printf("%s\n    {\"graph\": ", first ? "" : ",");
+    json_print_string(stdout, path);
+
+    GrB_Matrix graph = NULL;
+    GrB_Info info = bench_load(&graph, path, opts, samples[0]);
+    if (info != GrB_SUCCESS) {
+        printf(", \"error\": \"failed to load graph\"}");
+        fflush(stdout);
+        return;
+    }
+
+    GrB_Index n, nvals;
+    GrB_Matrix_nrows(&n, graph);
+    GrB_Matrix_nvals(&nvals, graph);
+    printf(", \"nodes\": %lu, \"edges\": %lu, ", n, nvals / 2);
+    if (strncmp(path, GEN_PREFIX, strlen(GEN_PREFIX)) == 0) {
+        int64_t ntri = gen_known_triangles(path + strlen(GEN_PREFIX));
+        if (ntri >= 0) printf("\"expected_ntri\": %ld, ", ntri);
+    }
+    print_phase("load", samples[0], opts->reps, true);
+
+    if (opts->max_threads > 0) {
+        bench_sweep(path, graph, opts, samples);
+        GrB_free(&graph);
+        return;
+    }
+
+    printf(", \"methods\": {");
+    bool first_method = true;
+    for (int i = 0; i < NMETHODS; ++i) {
+        if (!opts->selected[i]) {
+            continue;
+        }
+        fprintf(stderr, "    %s\n", METHODS[i]);
+        printf("%s\n        \"%s\": ", first_method ? "" : ",", METHODS[i]);
+        bench_method(path, i, graph, opts, samples);
+        first_method = false;
+        fflush(stdout);
+    }
+    printf("\n    }}");
+    fflush(stdout);
+
+    GrB_free(&graph);
+}
+
+// Select the methods in a comma separated list of names.  The list is
+// copied, since argv is reused if the process restarts for the sweep.
+static bool parse_methods(bench_options* opts, const char* methods) {
+    char* list = strdup(methods);
+    assert(list != NULL);
+    bool ok = true;
+    memset(opts->selected, 0, sizeof(opts->selected));
+    for (char* name = strtok(list, ","); ok && name != NULL; name = strtok(NULL, ",")) {
+        int i = 0;
+        while (i < NMETHODS && strcmp(name, METHODS[i]) != 0) {
+            ++i;
+        }
+        if (i == NMETHODS) {
+            fprintf(stderr, "unknown method %s\n", name);
+            ok = false;
+        } else {
+            opts->selected[i] = true;
+        }
+    }
+    free(list);
+    return ok;
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr, "usage: %s [-w warmup] [-r reps] [-m method,...] "
+        "[-s max_threads] [-o tables.md] [-t trace.json] [-p] "
+        "[-c baseline.json [-T threshold]] [-R] graph ...\n", prog);
+}
+
+int main(int argc, char* argv[]) {
+    bench_options opts;
+    opts.warmup = DEFAULT_WARMUP;
+    opts.reps = DEFAULT_REPS;
+    for (int i = 0; i < NMETHODS; ++i) {
+        opts.selected[i] = true;
+    }
+    opts.max_threads = 0;
+    opts.markdown_path = NULL;
+    opts.trace_path = NULL;
+    opts.counters = false;
+    opts.baseline = NULL;
+    opts.roofline = false;
+    opts.bandwidth = 0;
+    bool sweep = false;
+    const char* baseline_path = NULL;
+    double threshold = DEFAULT_THRESHOLD;
+
+    int arg = 1;
+    while (arg < argc && argv[arg][0] == '-') {
+        if (strcmp(argv[arg], "-p") == 0) {
+            opts.counters = true;
+            arg++;
+            continue;
+        }
+        if (strcmp(argv[arg], "-R") == 0) {
+            opts.roofline = true;
+            arg++;
+            continue;
+        }
+        if (arg + 1 == argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        if (strcmp(argv[arg], "-w") == 0) {
+            opts.warmup = atoi(argv[arg + 1]);
+        } else if (strcmp(argv[arg], "-r") == 0) {
+            opts.reps = atoi(argv[arg + 1]);
+        } else if (strcmp(argv[arg], "-m") == 0) {
+            if (!parse_methods(&opts, argv[arg + 1])) return 1;
+        } else if (strcmp(argv[arg], "-s") == 0) {
+            sweep = true;
+            opts.max_threads = atoi(argv[arg + 1]);
+        } else if (strcmp(argv[arg], "-o") == 0) {
+            opts.markdown_path = argv[arg + 1];
+        } else if (strcmp(argv[arg], "-t") == 0) {
+            opts.trace_path = argv[arg + 1];
+        } else if (strcmp(argv[arg], "-c") == 0) {
+            baseline_path = argv[arg + 1];
+        } else if (strcmp(argv[arg], "-T") == 0) {
+            threshold = atof(argv[arg + 1]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+        arg += 2;
+    }
+    if (arg == argc || opts.warmup < 0 || opts.reps < 1 || opts.max_threads < 0
+        || threshold < 0 || (sweep && (baseline_path != NULL || opts.roofline))) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bench_baseline baseline;
+    if (baseline_path != NULL) {
+        if (!bench_baseline_load(&baseline, baseline_path, threshold)) {
+            fprintf(stderr, "cannot read the baseline %s\n", baseline_path);
+            return 1;
+        }
+        opts.baseline = &baseline;
+    }
+
+    // A sweep goes up to the number of cores unless it is given
+    if (sweep) {
+        int ncores = bench_pin_threads(argv);
+        if (opts.max_threads == 0) opts.max_threads = ncores;
+    }
+
+    // The counters follow the threads created after they are opened, so they
+    // are opened before GraphBLAS starts its OpenMP threads
+    int ncounters = 0;
+    if (opts.counters) {
+        ncounters = perf_counters_open();
+        if (ncounters == 0) {
+            fprintf(stderr, "hardware counters are not available, running without them\n");
+            opts.counters = false;
+        } else if (ncounters < PERF_NCOUNTERS) {
+            fprintf(stderr, "only %d of %d hardware counters are available\n", ncounters,
+                PERF_NCOUNTERS);
+        }
+    }
+
+    // Same GraphBLAS settings as ./main
+    GrB_init(GrB_NONBLOCKING);
+    GxB_set(GxB_ARENA, true);
+    GxB_set(GxB_HUGE_PAGES, HUGE_PAGE_THRESHOLD);
+
+    int nthreads;
+    GxB_get(GxB_NTHREADS, &nthreads);
+    if (opts.roofline) {
+        fprintf(stderr, "measuring the memory bandwidth\n");
+        opts.bandwidth = bench_stream_bandwidth();
+    }
+
+    // one sample buffer per phase, shared by all graphs and methods
+    double* samples[NPHASES];
+    for (int p = 0; p < NPHASES; ++p) {
+        samples[p] = malloc(opts.reps * sizeof(double));
+        assert(samples[p] != NULL);
+    }
+
+    printf("{\"warmup\": %d, \"reps\": %d, \"nthreads\": %d, ",
+        opts.warmup, opts.reps, nthreads);
+    if (sweep) {
+        const char* bind = getenv("OMP_PROC_BIND");
+        const char* places = getenv("OMP_PLACES");
+        printf("\"max_threads\": %d, \"proc_bind\": ", opts.max_threads);
+        json_print_string(stdout, bind == NULL ? "" : bind);
+        printf(", \"places\": ");
+        json_print_string(stdout, places == NULL ? "" : places);
+        printf(", ");
+    }
+    if (opts.counters) {
+        printf("\"counters_available\": %d, ", ncounters);
+    }
+    if (opts.roofline) {
+        printf("\"stream_gbytes_per_second\": %f, ", opts.bandwidth / 1e9);
+    }
+    printf("\"graphs\": [");
+    for (int g = arg; g < argc; ++g) {
+        bench_graph(argv[g], &opts, samples, g == arg);
+    }
+    printf("\n]}\n");
+
+    if (opts.trace_path != NULL && GxB_Trace_write(opts.trace_path) != GrB_SUCCESS) {
+        fprintf(stderr, "%s\n", GrB_error());
+    }
+
+    for (int p = 0; p < NPHASES; ++p) {
+        free(samples[p]);
+    }
+    perf_counters_close();
+    GrB_finalize();
+
+    if (opts.baseline == NULL) {
+        return 0;
+    }
+    fprintf(stderr, "%d of %d results regressed against %s", baseline.nregressed,
+        baseline.ncompared, baseline_path);
+    if (baseline.nmissing > 0) {
+        fprintf(stderr, ", %d not in the baseline", baseline.nmissing);
+    }
+    fprintf(stderr, "\n");
+    int nregressed = baseline.nregressed;
+    bench_baseline_free(&baseline);
+    return nregressed > 0 ? EXIT_REGRESSED : 0;
+}
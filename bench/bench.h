@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "../deps/GraphBLAS/Demo/Include/demos.h"
+#include "compare.h"
+#include "roofline.h"
+#include "../perf/perf_counters.h"
+
+#define NMETHODS 8
+
+extern const char* METHODS[NMETHODS];
+
+// the timed phases of one method, in the order of mytricount's timer
+enum {
+    PHASE_MULTIPLY,
+    PHASE_REDUCE,
+    PHASE_PREP,
+    PHASE_TOTAL,
+    NPHASES
+};
+
+extern const char* PHASE_NAMES[NPHASES];
+
+typedef struct {
+    int warmup;                 // untimed runs before the timed ones
+    int reps;                   // timed runs
+    bool selected[NMETHODS];    // methods to run
+    int max_threads;            // thread sweep up to this count, 0 for none
+    const char* markdown_path;  // markdown tables of the sweep, if not NULL
+    const char* trace_path;     // GraphBLAS trace of all runs, if not NULL
+    bool counters;              // hardware counters are open
+    bench_baseline* baseline;   // results to compare with, if not NULL
+    bool roofline;              // report the roofline of each method
+    double bandwidth;           // STREAM bandwidth, bytes/s, for the roofline
+} bench_options;
+
+// Run one method warmup + reps times.  The times of the timed runs are
+// written to samples [phase][0..reps-1].  If opts->counters is set, the
+// hardware counts of each phase, summed over the timed runs, are written to
+// counters [0..PERF_NPHASES-1].
+GrB_Info bench_run_method(
+    int64_t* ntri,              // # of triangles found
+    int64_t* peak_bytes,        // largest GraphBLAS memory use of a timed run,
+                                // above what was in use before it
+    perf_sample* counters,
+    int method,                 // index into METHODS
+    GrB_Matrix graph,           // adjacency matrix
+    const bench_options* opts,
+    double* samples[NPHASES]
+);
+
+// Write the hardware counts of every phase as a ", \"counters\": {...}" JSON
+// member, if opts->counters is set
+void bench_print_counters(const perf_sample* counters, const bench_options* opts);
+
+// Write the statistics of samples [phase][0..reps-1] of every phase as
+// ", \"phase\": {...}" JSON members
+void bench_print_phases(double* samples[NPHASES], int reps);
+
+// Time every selected method with 1, 2, 4, ... max_threads threads and write
+// one JSON object per method, with the speedup, parallel efficiency and
+// edges per second of each thread count.  The markdown tables are appended
+// to opts->markdown_path.
+void bench_sweep(
+    const char* path,           // name of the graph
+    GrB_Matrix graph,           // adjacency matrix
+    const bench_options* opts,
+    double* samples[NPHASES]
+);
+
+// Pin the OpenMP threads to cores for the sweep, by setting whichever of
+// OMP_PROC_BIND and OMP_PLACES is not set yet and restarting the process.
+// Returns the number of cores (OpenMP places) to sweep up to.
+int bench_pin_threads(char* argv[]);
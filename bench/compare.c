@@ -0,0 +1,97 @@
+// Regression gate: compare a run of the benchmark with a stored baseline.
+//
+// The baseline is the JSON document of an earlier run.  It only holds the
+// summary statistics of each phase, so the statistical test is Welch's
+// t-test on the means, which needs nothing more.  The threshold on the
+// median keeps statistically significant but negligible slowdowns from
+// failing the gate; the t-test keeps noisy runs from failing it.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "compare.h"
+#include "stats.h"
+
+// significance level of the t-test
+#define REGRESSION_ALPHA 0.05
+
+bool bench_baseline_load(bench_baseline* baseline, const char* path, double threshold) {
+    memset(baseline, 0, sizeof(bench_baseline));
+    baseline->threshold = threshold;
+    baseline->root = json_parse_file(path);
+    return baseline->root != NULL;
+}
+
+// The baseline result of a method on a graph, or NULL
+static const json_value* find_result(const bench_baseline* baseline, const char* graph,
+    const char* method) {
+    const json_value* graphs = json_get(baseline->root, "graphs");
+    if (graphs == NULL || graphs->type != JSON_ARRAY) {
+        return NULL;
+    }
+    for (size_t g = 0; g < graphs->count; ++g) {
+        const json_value* name = json_get(&graphs->items[g], "graph");
+        if (name != NULL && name->type == JSON_STRING && strcmp(name->string, graph) == 0) {
+            return json_get(json_get(&graphs->items[g], "methods"), method);
+        }
+    }
+    return NULL;
+}
+
+static void stats_from_json(bench_stats* stats, const json_value* value) {
+    memset(stats, 0, sizeof(bench_stats));
+    stats->n = (int) json_get_number(value, "n", 0);
+    stats->min = json_get_number(value, "min", 0);
+    stats->median = json_get_number(value, "median", 0);
+    stats->p95 = json_get_number(value, "p95", 0);
+    stats->max = json_get_number(value, "max", 0);
+    stats->mean = json_get_number(value, "mean", 0);
+    stats->stddev = json_get_number(value, "stddev", 0);
+}
+
+void bench_compare_method(bench_baseline* baseline, const char* graph, const char* method,
+    int64_t ntri, const double* samples, int reps) {
+    const json_value* result = find_result(baseline, graph, method);
+    const json_value* total = json_get(result, "total");
+    if (total == NULL) {
+        baseline->nmissing++;
+        printf(", \"baseline\": null");
+        return;
+    }
+
+    bench_stats before, after;
+    stats_from_json(&before, total);
+    bench_stats_compute(&after, samples, reps);
+    double change = (before.median > 0) ? after.median / before.median - 1 : 0;
+    double p = bench_stats_welch_p(&before, &after);
+    int64_t ntri_before = (int64_t) json_get_number(result, "ntri", -1);
+
+    // with a single sample on either side only the threshold is left
+    bool slower = change > baseline->threshold && p < REGRESSION_ALPHA;
+    bool wrong = ntri_before != ntri;
+    bool regressed = slower || wrong;
+    baseline->ncompared++;
+    if (regressed) {
+        baseline->nregressed++;
+        fprintf(stderr, "REGRESSION %s %s: ", graph, method);
+        if (wrong) {
+            fprintf(stderr, "%ld triangles instead of %ld\n", ntri, ntri_before);
+        } else {
+            fprintf(stderr, "median %f s -> %f s (%+.1f%%, p = %.4f)\n", before.median,
+                after.median, 100 * change, p);
+        }
+    }
+
+    printf(", \"baseline\": {\"median\": %.9f, \"change\": %f, ", before.median, change);
+    if (p < 0) {
+        printf("\"p_value\": null, ");
+    } else {
+        printf("\"p_value\": %f, ", p);
+    }
+    printf("\"ntri\": %ld, \"regressed\": %s}", ntri_before, regressed ? "true" : "false");
+}
+
+void bench_baseline_free(bench_baseline* baseline) {
+    json_free(baseline->root);
+    baseline->root = NULL;
+}
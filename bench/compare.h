@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "json.h"
+
+// A stored tricount_bench result to compare a new run against
+typedef struct {
+    json_value* root;           // the baseline document
+    double threshold;           // relative median slowdown that is a regression
+    int ncompared;              // method/graph results compared so far
+    int nregressed;             // of which regressed
+    int nmissing;               // not in the baseline
+} bench_baseline;
+
+// Read the baseline JSON written by an earlier tricount_bench run (without
+// -s).  Returns false if it cannot be read.
+bool bench_baseline_load(bench_baseline* baseline, const char* path, double threshold);
+
+// Compare the total time samples [0..reps-1] and triangle count of a method
+// on a graph with the baseline, and write the outcome as a
+// ", \"baseline\": {...}" JSON member.  A result regressed if its median is
+// more than the threshold slower than the baseline median and Welch's t-test
+// finds the mean slower at the 5% level, or if its triangle count changed.
+void bench_compare_method(
+    bench_baseline* baseline,
+    const char* graph,          // as given on the command line
+    const char* method,         // name in METHODS
+    int64_t ntri,
+    const double* samples,      // total time of each timed run
+    int reps
+);
+
+void bench_baseline_free(bench_baseline* baseline);
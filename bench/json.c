@@ -0,0 +1,235 @@
+// A minimal recursive descent JSON reader.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "json.h"
+
+#define MAX_JSON_DEPTH 64
+
+typedef struct {
+    const char* s;
+    int depth;
+} json_parser;
+
+static bool parse_value(json_parser* p, json_value* value);
+
+static void skip_space(json_parser* p) {
+    while (*p->s == ' ' || *p->s == '\t' || *p->s == '\n' || *p->s == '\r') {
+        p->s++;
+    }
+}
+
+static void free_content(json_value* value) {
+    free(value->string);
+    for (size_t k = 0; k < value->count; ++k) {
+        free_content(&value->items[k]);
+        if (value->keys != NULL) free(value->keys[k]);
+    }
+    free(value->items);
+    free(value->keys);
+}
+
+// A string, after its opening quote
+static char* parse_string(json_parser* p) {
+    size_t len = 0;
+    while (p->s[len] != '"') {
+        if (p->s[len] == '\0') return NULL;
+        if (p->s[len] == '\\' && p->s[len + 1] != '\0') len++;
+        len++;
+    }
+    char* string = malloc(len + 1);
+    if (string == NULL) return NULL;
+    size_t n = 0;
+    for (size_t k = 0; k < len; ++k) {
+        if (p->s[k] == '\\' && (p->s[k + 1] == '"' || p->s[k + 1] == '\\')) k++;
+        string[n++] = p->s[k];
+    }
+    string[n] = '\0';
+    p->s += len + 1;
+    return string;
+}
+
+// Append an item to an array or object
+static bool append(json_value* value, json_value* item, char* key) {
+    json_value* items = realloc(value->items, (value->count + 1) * sizeof(json_value));
+    if (items == NULL) return false;
+    value->items = items;
+    if (value->type == JSON_OBJECT) {
+        char** keys = realloc(value->keys, (value->count + 1) * sizeof(char*));
+        if (keys == NULL) return false;
+        value->keys = keys;
+        value->keys[value->count] = key;
+    }
+    value->items[value->count++] = *item;
+    return true;
+}
+
+// An array or object, after its opening bracket
+static bool parse_items(json_parser* p, json_value* value, char close) {
+    skip_space(p);
+    if (*p->s == close) {
+        p->s++;
+        return true;
+    }
+    while (true) {
+        char* key = NULL;
+        if (value->type == JSON_OBJECT) {
+            skip_space(p);
+            if (*p->s != '"') return false;
+            p->s++;
+            key = parse_string(p);
+            if (key == NULL) return false;
+            skip_space(p);
+            if (*p->s != ':') {
+                free(key);
+                return false;
+            }
+            p->s++;
+        }
+        json_value item;
+        if (!parse_value(p, &item)) {
+            free(key);
+            return false;
+        }
+        if (!append(value, &item, key)) {
+            free_content(&item);
+            free(key);
+            return false;
+        }
+        skip_space(p);
+        if (*p->s == close) {
+            p->s++;
+            return true;
+        }
+        if (*p->s != ',') return false;
+        p->s++;
+    }
+}
+
+static bool parse_literal(json_parser* p, const char* literal) {
+    size_t len = strlen(literal);
+    if (strncmp(p->s, literal, len) != 0) return false;
+    p->s += len;
+    return true;
+}
+
+static bool parse_value(json_parser* p, json_value* value) {
+    memset(value, 0, sizeof(json_value));
+    skip_space(p);
+    char c = *p->s;
+    if (c == '{' || c == '[') {
+        if (++p->depth > MAX_JSON_DEPTH) return false;
+        p->s++;
+        value->type = (c == '{') ? JSON_OBJECT : JSON_ARRAY;
+        bool ok = parse_items(p, value, (c == '{') ? '}' : ']');
+        p->depth--;
+        if (!ok) free_content(value);
+        return ok;
+    }
+    if (c == '"') {
+        p->s++;
+        value->type = JSON_STRING;
+        value->string = parse_string(p);
+        return value->string != NULL;
+    }
+    if (c == 't' || c == 'f') {
+        value->type = JSON_BOOL;
+        value->number = (c == 't');
+        return parse_literal(p, (c == 't') ? "true" : "false");
+    }
+    if (c == 'n') {
+        value->type = JSON_NULL;
+        return parse_literal(p, "null");
+    }
+    char* end;
+    value->type = JSON_NUMBER;
+    value->number = strtod(p->s, &end);
+    if (end == p->s) return false;
+    p->s = end;
+    return true;
+}
+
+json_value* json_parse_file(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        return NULL;
+    }
+    char* text = NULL;
+    size_t size = 0, len = 0;
+    bool ok = true;
+    while (ok) {
+        if (len + 1 >= size) {
+            size = (size == 0) ? 4096 : 2 * size;
+            char* grown = realloc(text, size);
+            ok = (grown != NULL);
+            if (!ok) break;
+            text = grown;
+        }
+        size_t nread = fread(text + len, 1, size - len - 1, f);
+        if (nread == 0) break;
+        len += nread;
+    }
+    fclose(f);
+    json_value* value = ok ? malloc(sizeof(json_value)) : NULL;
+    if (value == NULL) {
+        free(text);
+        return NULL;
+    }
+    text[len] = '\0';
+
+    json_parser p = {text, 0};
+    ok = parse_value(&p, value);
+    skip_space(&p);
+    if (ok && *p.s != '\0') {
+        free_content(value);
+        ok = false;
+    }
+    free(text);
+    if (!ok) {
+        free(value);
+        return NULL;
+    }
+    return value;
+}
+
+const json_value* json_get(const json_value* value, const char* key) {
+    if (value == NULL || value->type != JSON_OBJECT) {
+        return NULL;
+    }
+    for (size_t k = 0; k < value->count; ++k) {
+        if (strcmp(value->keys[k], key) == 0) {
+            return &value->items[k];
+        }
+    }
+    return NULL;
+}
+
+double json_get_number(const json_value* value, const char* key, double fallback) {
+    const json_value* member = json_get(value, key);
+    return (member != NULL && member->type == JSON_NUMBER) ? member->number : fallback;
+}
+
+void json_free(json_value* value) {
+    if (value != NULL) {
+        free_content(value);
+        free(value);
+    }
+}
+
+void json_print_string(FILE* f, const char* s) {
+    fputc('"', f);
+    for (; *s != '\0'; ++s) {
+        unsigned char c = (unsigned char) *s;
+        if (c == '"' || c == '\\') {
+            fprintf(f, "\\%c", c);
+        } else if (c < 0x20) {
+            fprintf(f, "\\u%04x", c);
+        } else {
+            fputc(c, f);
+        }
+    }
+    fputc('"', f);
+}
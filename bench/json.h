@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdio.h>
+
+// A minimal JSON reader, enough to read back the documents tricount_bench
+// writes.  Strings keep their escapes undecoded except for \" and \\.
+
+typedef enum {
+    JSON_NULL,
+    JSON_BOOL,
+    JSON_NUMBER,
+    JSON_STRING,
+    JSON_ARRAY,
+    JSON_OBJECT
+} json_type;
+
+typedef struct json_value {
+    json_type type;
+    double number;              // JSON_NUMBER, and 0/1 for JSON_BOOL
+    char* string;               // JSON_STRING
+    struct json_value* items;   // elements of JSON_ARRAY, values of JSON_OBJECT
+    char** keys;                // keys of JSON_OBJECT
+    size_t count;               // # of items
+} json_value;
+
+// Read the JSON document in path.  Returns NULL if the file cannot be read or
+// is not valid JSON.
+json_value* json_parse_file(const char* path);
+
+// The member key of an object, or NULL if value is not an object or has no
+// such member
+const json_value* json_get(const json_value* value, const char* key);
+
+// The number in the member key of an object, or fallback if there is none
+double json_get_number(const json_value* value, const char* key, double fallback);
+
+void json_free(json_value* value);
+
+// Write s to f as a JSON string literal, with \" and \\ escaped and control
+// characters written as \u00XX
+void json_print_string(FILE* f, const char* s);
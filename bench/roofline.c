@@ -0,0 +1,118 @@
+// Roofline-style efficiency of the triangle counting multiplies.
+//
+// The bytes a multiply C<M> = A*B moves are estimated from the GxB_Stats
+// record of each mxm: every entry of A, B and the mask is read once and
+// every entry of C written once, each as a 64-bit index and a 32-bit value,
+// with one vector pointer array per matrix.  On top of that, every
+// multiply-add gathers one entry of an operand, which the sparse access
+// pattern rarely finds in cache.  The estimate ignores the reuse the cache
+// does give, so the achieved bandwidth it yields is an upper bound.
+
+#include <omp.h>
+#include <stdlib.h>
+
+#include "roofline.h"
+#include "../mytricount/mytricount.h"
+
+// bytes of one entry: its index and its GrB_UINT32 value
+#define ENTRY_BYTES (sizeof(int64_t) + sizeof(uint32_t))
+#define POINTER_BYTES sizeof(int64_t)
+
+// STREAM: arrays well beyond the last-level cache, best of several runs
+#define STREAM_SIZE ((size_t) 1 << 24)
+#define STREAM_NTIMES 10
+#define STREAM_SCALAR 3.0
+
+double bench_stream_bandwidth(void) {
+    double* a = malloc(STREAM_SIZE * sizeof(double));
+    double* b = malloc(STREAM_SIZE * sizeof(double));
+    double* c = malloc(STREAM_SIZE * sizeof(double));
+    if (a == NULL || b == NULL || c == NULL) {
+        free(a);
+        free(b);
+        free(c);
+        return 0;
+    }
+
+    // first touch by the threads that run the triad
+    #pragma omp parallel for schedule(static)
+    for (size_t k = 0; k < STREAM_SIZE; ++k) {
+        a[k] = 0;
+        b[k] = 1;
+        c[k] = 2;
+    }
+
+    double best = 0;
+    for (int run = 0; run < STREAM_NTIMES; ++run) {
+        double start = omp_get_wtime();
+        #pragma omp parallel for schedule(static)
+        for (size_t k = 0; k < STREAM_SIZE; ++k) {
+            a[k] = b[k] + STREAM_SCALAR * c[k];
+        }
+        double time = omp_get_wtime() - start;
+        // two arrays read and one written, as STREAM counts it
+        double bandwidth = 3 * sizeof(double) * STREAM_SIZE / time;
+        if (bandwidth > best) best = bandwidth;
+    }
+
+    free(a);
+    free(b);
+    free(c);
+    return best;
+}
+
+GrB_Info bench_traffic_measure(bench_traffic* traffic, int method, GrB_Matrix graph) {
+    traffic->bytes = 0;
+    traffic->flops = 0;
+    traffic->nmxm = 0;
+
+    GrB_Index n;
+    GrB_Matrix_nrows(&n, graph);
+
+    GxB_set(GxB_STATS, true);
+    GxB_Stats_clear();
+    int64_t ntri;
+    double timer[3];
+    GrB_Info info = mytricount(&ntri, NULL, method, graph, timer);
+    GxB_set(GxB_STATS, false);
+    if (info != GrB_SUCCESS) {
+        return info;
+    }
+
+    GxB_Stats* records = malloc(GxB_STATS_LOG_SIZE * sizeof(GxB_Stats));
+    if (records == NULL) {
+        return GrB_OUT_OF_MEMORY;
+    }
+    GrB_Index nrecords = GxB_STATS_LOG_SIZE;
+    info = GxB_Stats_get(records, &nrecords);
+    for (GrB_Index k = 0; info == GrB_SUCCESS && k < nrecords; ++k) {
+        const GxB_Stats* r = &records[k];
+        if (r->op != GxB_STATS_MXM) {
+            continue;
+        }
+        int nmatrices = (r->mnz > 0) ? 4 : 3;
+        traffic->bytes += ENTRY_BYTES * ((double) r->anz + r->bnz + r->mnz + r->cnz + r->flops)
+            + POINTER_BYTES * (double) (n + 1) * nmatrices;
+        traffic->flops += r->flops;
+        traffic->nmxm++;
+    }
+    free(records);
+    return info;
+}
+
+void bench_print_roofline(const bench_traffic* traffic, double multiply_time,
+    double bandwidth) {
+    // method 7 counts without a multiply
+    if (traffic->nmxm == 0 || traffic->bytes <= 0 || multiply_time <= 0) {
+        printf(", \"roofline\": null");
+        return;
+    }
+    double achieved = traffic->bytes / multiply_time;
+    double intensity = traffic->flops / traffic->bytes;
+    printf(", \"roofline\": {\"mxm\": %d, \"bytes\": %.0f, \"flops\": %.0f, "
+        "\"intensity\": %f, \"gbytes_per_second\": %f, \"percent_of_peak\": %f, "
+        "\"gflops\": %f, \"bound_gflops\": %f}",
+        traffic->nmxm, traffic->bytes, traffic->flops, intensity, achieved / 1e9,
+        bandwidth > 0 ? 100 * achieved / bandwidth : 0, traffic->flops / multiply_time / 1e9,
+        bandwidth * intensity / 1e9);
+}
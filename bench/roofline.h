@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "../deps/GraphBLAS/Demo/Include/demos.h"
+
+// Estimated memory traffic and work of the multiplies of one method run
+typedef struct {
+    double bytes;               // estimated bytes moved
+    double flops;               // multiply-adds, from the GxB_Stats log
+    int nmxm;                   // # of mxm operations
+} bench_traffic;
+
+// The sustainable memory bandwidth of the machine, in bytes per second, as
+// the best of several STREAM triad runs on all threads
+double bench_stream_bandwidth(void);
+
+// Run a method once more with the GraphBLAS telemetry on, and estimate the
+// traffic of its multiplies from the entries of the operands and the flops
+// of each mxm.  Kept apart from the timed runs, since the telemetry counts
+// the flops of the saxpy methods with an extra pass.
+GrB_Info bench_traffic_measure(
+    bench_traffic* traffic,
+    int method,                 // index into METHODS
+    GrB_Matrix graph            // adjacency matrix
+);
+
+// Write the roofline of a method as a ", \"roofline\": {...}" JSON member:
+// the achieved bandwidth of its multiply phase and the percentage of the
+// STREAM bandwidth it reaches, its arithmetic intensity and the flop rate
+// the bandwidth allows at that intensity
+void bench_print_roofline(
+    const bench_traffic* traffic,
+    double multiply_time,       // median time of the multiply phase
+    double bandwidth            // from bench_stream_bandwidth
+);
@@ -0,0 +1,128 @@
+// Summary statistics of benchmark samples.
+//
+// The percentiles use the nearest-rank definition on the sorted samples, so
+// every reported value is one that was actually measured.
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "stats.h"
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*) a;
+    double y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+// p-th percentile (0 < p <= 100) of the sorted samples, nearest rank
+static double percentile(const double* sorted, int n, double p) {
+    int rank = (int) ceil(p / 100.0 * n);
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    return sorted[rank - 1];
+}
+
+void bench_stats_compute(bench_stats* stats, const double* samples, int n) {
+    memset(stats, 0, sizeof(bench_stats));
+    stats->n = n;
+    if (n <= 0) {
+        return;
+    }
+
+    double* sorted = malloc(n * sizeof(double));
+    if (sorted == NULL) {
+        stats->n = 0;
+        return;
+    }
+    memcpy(sorted, samples, n * sizeof(double));
+    qsort(sorted, n, sizeof(double), compare_double);
+
+    stats->min = sorted[0];
+    stats->max = sorted[n - 1];
+    stats->median = (n % 2 == 1) ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+    stats->p95 = percentile(sorted, n, 95);
+
+    double sum = 0;
+    for (int k = 0; k < n; ++k) {
+        sum += sorted[k];
+    }
+    stats->mean = sum / n;
+
+    if (n > 1) {
+        double ss = 0;
+        for (int k = 0; k < n; ++k) {
+            double d = sorted[k] - stats->mean;
+            ss += d * d;
+        }
+        stats->stddev = sqrt(ss / (n - 1));
+    }
+    free(sorted);
+}
+
+void bench_stats_print_json(FILE* f, const bench_stats* stats) {
+    fprintf(f, "{\"n\": %d, \"min\": %.9f, \"median\": %.9f, \"p95\": %.9f, "
+        "\"max\": %.9f, \"mean\": %.9f, \"stddev\": %.9f}",
+        stats->n, stats->min, stats->median, stats->p95,
+        stats->max, stats->mean, stats->stddev);
+}
+
+// Continued fraction of the regularized incomplete beta function, by the
+// modified Lentz method
+static double beta_fraction(double a, double b, double x) {
+    const double tiny = 1e-300;
+    double c = 1, d = 1 - (a + b) * x / (a + 1);
+    if (fabs(d) < tiny) d = tiny;
+    d = 1 / d;
+    double h = d;
+    for (int m = 1; m <= 200; ++m) {
+        double aa = m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m));
+        d = 1 + aa * d;
+        if (fabs(d) < tiny) d = tiny;
+        c = 1 + aa / c;
+        if (fabs(c) < tiny) c = tiny;
+        d = 1 / d;
+        h *= d * c;
+        aa = -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1));
+        d = 1 + aa * d;
+        if (fabs(d) < tiny) d = tiny;
+        c = 1 + aa / c;
+        if (fabs(c) < tiny) c = tiny;
+        d = 1 / d;
+        double delta = d * c;
+        h *= delta;
+        if (fabs(delta - 1) < 1e-12) break;
+    }
+    return h;
+}
+
+// I_x (a, b)
+static double incomplete_beta(double a, double b, double x) {
+    if (x <= 0) return 0;
+    if (x >= 1) return 1;
+    double front = exp(lgamma(a + b) - lgamma(a) - lgamma(b) + a * log(x) + b * log(1 - x));
+    if (x < (a + 1) / (a + b + 2)) {
+        return front * beta_fraction(a, b, x) / a;
+    }
+    return 1 - front * beta_fraction(b, a, 1 - x) / b;
+}
+
+double bench_stats_welch_p(const bench_stats* before, const bench_stats* after) {
+    if (before->n < 2 || after->n < 2) {
+        return -1;
+    }
+    double v0 = before->stddev * before->stddev / before->n;
+    double v1 = after->stddev * after->stddev / after->n;
+    double diff = after->mean - before->mean;
+    if (v0 + v1 == 0) {
+        // no spread at all: the difference is certain
+        return diff > 0 ? 0 : 1;
+    }
+    double t = diff / sqrt(v0 + v1);
+    double df = (v0 + v1) * (v0 + v1)
+        / (v0 * v0 / (before->n - 1) + v1 * v1 / (after->n - 1));
+
+    // P(T > |t|) for Student's t with df degrees of freedom
+    double tail = 0.5 * incomplete_beta(df / 2, 0.5, df / (df + t * t));
+    return t > 0 ? tail : 1 - tail;
+}
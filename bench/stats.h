@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdio.h>
+
+// Summary statistics of the timed repetitions of one benchmark phase
+typedef struct {
+    int n;              // number of samples
+    double min;
+    double median;
+    double p95;         // 95th percentile, nearest rank
+    double max;
+    double mean;
+    double stddev;      // sample standard deviation, 0 if n < 2
+} bench_stats;
+
+// Compute the statistics of samples [0..n-1].  The samples are not modified.
+void bench_stats_compute(bench_stats* stats, const double* samples, int n);
+
+// Write the statistics as a JSON object
+void bench_stats_print_json(FILE* f, const bench_stats* stats);
+
+// One-sided p-value of Welch's t-test that the mean of after is larger than
+// the mean of before, from their summary statistics.  Returns -1 if either
+// has fewer than two samples.
+double bench_stats_welch_p(const bench_stats* before, const bench_stats* after);
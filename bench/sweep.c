@@ -0,0 +1,164 @@
+// Thread-scaling sweep of the benchmark driver.
+//
+// Every selected method is timed with 1, 2, 4, ... threads, ending with
+// max_threads, set through GxB_NTHREADS.  For each thread count the speedup
+// and the parallel efficiency are computed from the median total time
+// (multiply + reduce) relative to the run with one thread, and the
+// throughput is the number of undirected edges divided by the same median.
+//
+// The OpenMP threads are pinned one per core (OMP_PROC_BIND=close,
+// OMP_PLACES=cores) so that repeated sweeps land on the same cores.  The
+// OpenMP runtime only reads these variables at startup, so when either is not
+// set the process sets it and restarts itself; a value the user gave is kept.
+
+#include <omp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "stats.h"
+
+#define MAX_SWEEP_STEPS 64
+
+// 1, 2, 4, ... up to and including max_threads
+static int thread_counts(int* counts, int max_threads) {
+    int nsteps = 0;
+    for (int t = 1; t < max_threads && nsteps < MAX_SWEEP_STEPS - 1; t *= 2) {
+        counts[nsteps++] = t;
+    }
+    counts[nsteps++] = max_threads;
+    return nsteps;
+}
+
+int bench_pin_threads(char* argv[]) {
+    // each variable the user set is kept as is
+    bool set_bind = getenv("OMP_PROC_BIND") == NULL;
+    bool set_places = getenv("OMP_PLACES") == NULL;
+    if (set_bind || set_places) {
+        if (set_bind) setenv("OMP_PROC_BIND", "close", 1);
+        if (set_places) setenv("OMP_PLACES", "cores", 1);
+        execv("/proc/self/exe", argv);
+        // only reached if the restart failed: sweep as the user left it
+        fprintf(stderr, "cannot restart with pinned threads, sweeping unpinned\n");
+        if (set_bind) unsetenv("OMP_PROC_BIND");
+        if (set_places) unsetenv("OMP_PLACES");
+    }
+
+    int ncores = omp_get_num_places();
+    return ncores > 0 ? ncores : omp_get_num_procs();
+}
+
+// One markdown table of a value for every thread count and method, in the
+// format of fullgraph_results.md
+static void write_table(FILE* f, const char* title, const char* unit, const char* format,
+    double values[][NMETHODS], const int* counts, int nsteps, const bench_options* opts) {
+    fprintf(f, "\n%s\n\n| Threads |", title);
+    for (int i = 0; i < NMETHODS; ++i) {
+        if (opts->selected[i]) fprintf(f, " %s %s |", METHODS[i], unit);
+    }
+    fprintf(f, "\n|:-:|");
+    for (int i = 0; i < NMETHODS; ++i) {
+        if (opts->selected[i]) fprintf(f, ":-:|");
+    }
+    fprintf(f, "\n");
+    for (int s = 0; s < nsteps; ++s) {
+        fprintf(f, "| %d |", counts[s]);
+        for (int i = 0; i < NMETHODS; ++i) {
+            if (!opts->selected[i]) continue;
+            fprintf(f, " ");
+            fprintf(f, format, values[s][i]);
+            fprintf(f, " |");
+        }
+        fprintf(f, "\n");
+    }
+}
+
+static void write_markdown(const char* path, const bench_options* opts, const int* counts,
+    int nsteps, double time[][NMETHODS], double speedup[][NMETHODS],
+    double efficiency[][NMETHODS], double rate[][NMETHODS]) {
+    FILE* f = fopen(opts->markdown_path, "a");
+    if (f == NULL) {
+        fprintf(stderr, "cannot open %s\n", opts->markdown_path);
+        return;
+    }
+    fprintf(f, "\n## %s\n", path);
+    write_table(f, "Median time", "time (s)", "%f", time, counts, nsteps, opts);
+    write_table(f, "Speedup", "speedup", "%.2f", speedup, counts, nsteps, opts);
+    write_table(f, "Parallel efficiency", "efficiency", "%.2f", efficiency, counts, nsteps,
+        opts);
+    write_table(f, "Throughput", "edges/s", "%.4g", rate, counts, nsteps, opts);
+    fclose(f);
+}
+
+void bench_sweep(const char* path, GrB_Matrix graph, const bench_options* opts,
+    double* samples[NPHASES]) {
+    int counts[MAX_SWEEP_STEPS];
+    int nsteps = thread_counts(counts, opts->max_threads);
+
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, graph);
+    double nedges = nvals / 2.0;
+
+    double time[MAX_SWEEP_STEPS][NMETHODS];
+    double speedup[MAX_SWEEP_STEPS][NMETHODS];
+    double efficiency[MAX_SWEEP_STEPS][NMETHODS];
+    double rate[MAX_SWEEP_STEPS][NMETHODS];
+    memset(time, 0, sizeof(time));
+    memset(speedup, 0, sizeof(speedup));
+    memset(efficiency, 0, sizeof(efficiency));
+    memset(rate, 0, sizeof(rate));
+
+    int nthreads_default;
+    GxB_get(GxB_NTHREADS, &nthreads_default);
+
+    printf(", \"methods\": {");
+    bool first_method = true;
+    for (int i = 0; i < NMETHODS; ++i) {
+        if (!opts->selected[i]) {
+            continue;
+        }
+        fprintf(stderr, "    %s\n", METHODS[i]);
+        printf("%s\n        \"%s\": {\"threads\": [", first_method ? "" : ",", METHODS[i]);
+        first_method = false;
+
+        int64_t ntri = 0, peak_bytes = 0;
+        perf_sample counters[PERF_NPHASES];
+        GrB_Info info = GrB_SUCCESS;
+        for (int s = 0; s < nsteps && info == GrB_SUCCESS; ++s) {
+            GxB_set(GxB_NTHREADS, counts[s]);
+            info = bench_run_method(&ntri, &peak_bytes, counters, i, graph, opts, samples);
+            if (info != GrB_SUCCESS) {
+                break;
+            }
+
+            bench_stats total;
+            bench_stats_compute(&total, samples[PHASE_TOTAL], opts->reps);
+            time[s][i] = total.median;
+            speedup[s][i] = (total.median > 0) ? time[0][i] / total.median : 0;
+            efficiency[s][i] = speedup[s][i] / counts[s];
+            rate[s][i] = (total.median > 0) ? nedges / total.median : 0;
+
+            printf("%s\n            {\"nthreads\": %d", (s == 0) ? "" : ",", counts[s]);
+            bench_print_phases(samples, opts->reps);
+            bench_print_counters(counters, opts);
+            printf(", \"speedup\": %f, \"efficiency\": %f, \"edges_per_second\": %f, "
+                "\"peak_bytes\": %ld}", speedup[s][i], efficiency[s][i], rate[s][i], peak_bytes);
+            fflush(stdout);
+        }
+
+        if (info != GrB_SUCCESS) {
+            printf("], \"error\": %d}", info);
+        } else {
+            printf("], \"ntri\": %ld}", ntri);
+        }
+    }
+    printf("\n    }}");
+    fflush(stdout);
+
+    GxB_set(GxB_NTHREADS, nthreads_default);
+
+    if (opts->markdown_path != NULL) {
+        write_markdown(path, opts, counts, nsteps, time, speedup, efficiency, rate);
+    }
+}
@@ -3066,11 +3066,15 @@ GrB_Info GrB_Matrix_extractTuples           // [I,J,X] = find (A)
 //       In other words, C<Mask> = accum (C,T) is split into Z = accum(C,T) ;
 //       C=0 ; C<Mask> = Z.
 //
-// GrB_MASK: can be GxB_DEFAULT or GrB_SCMP.  If GxB_DEFAULT, the mask is used
-//      normally, where Mask(i,j)=1 means C(i,j) can be modified by C<Mask>=Z,
-//      and Mask(i,j)=0 means it cannot be modified even if Z(i,j) is has been
-//      computed and differs from C(i,j).  If GrB_SCMP, this is the same as
-//      taking the logical complement of the Mask.
+// GrB_MASK: can be GxB_DEFAULT, GrB_SCMP, GxB_STRUCTURE, or GxB_STRUCT_COMP.
+//      If GxB_DEFAULT, the mask is used normally, where Mask(i,j)=1 means
+//      C(i,j) can be modified by C<Mask>=Z, and Mask(i,j)=0 means it cannot be
+//      modified even if Z(i,j) is has been computed and differs from C(i,j).
+//      If GrB_SCMP, this is the same as taking the logical complement of the
+//      Mask.  If GxB_STRUCTURE, only the pattern of the Mask is used:
+//      Mask(i,j)=1 if the entry is present, even if its value is zero, and the
+//      values of the Mask are never read.  GxB_STRUCT_COMP is the logical
+//      complement of the structural Mask.
 //
 // GrB_INP0: can be GxB_DEFAULT or GrB_TRAN.  If GxB_DEFAULT, the first input
 //      is used as-is.  If GrB_TRAN, it is transposed.  Only matrices are
@@ -3169,6 +3173,10 @@ typedef enum
     // for GrB_MASK only: these two options are identical
     GrB_SCMP = 2,       // use the structural complement of the input
 
+    // for GrB_MASK only: use the pattern of the mask, not its values
+    GxB_STRUCTURE = 4,      // M(i,j)=1 if the entry is present
+    GxB_STRUCT_COMP = 6,    // GrB_SCMP and GxB_STRUCTURE together
+
     // for GrB_INP0 and GrB_INP1 only:
     GrB_TRAN = 3,       // use the transpose of the input
 
@@ -3310,7 +3318,25 @@ typedef enum            // for global options or matrix options
     GxB_API_VERSION = 16,           // API version (3 int's)
     GxB_API_DATE = 17,              // date of the API (char *)
     GxB_API_ABOUT = 18,             // about the API (char *)
-    GxB_API_URL = 19                // URL for the API (char *)
+    GxB_API_URL = 19,               // URL for the API (char *)
+
+    // GxB_Global_Option_get/set only:
+    GxB_ARENA = 20,     // if true, take workspace from a thread-local arena
+    GxB_NUMA = 21,      // NUMA placement of matrix content (GxB_NUMA_Policy)
+    GxB_HUGE_PAGES = 22,    // blocks of at least this many bytes (an int64_t)
+                        // are put on transparent huge pages; 0 to disable
+
+    // GxB_Global_Option_get only:
+    GxB_HUGE_PAGE_BYTES = 23,   // # of bytes on huge pages (an int64_t)
+
+    // GxB_Global_Option_get/set only:
+    GxB_STATS = 24,     // if true, record per-operation telemetry (GxB_Stats)
+
+    // GxB_Global_Option_get only:
+    GxB_MEMORY_INUSE = 25,  // # of bytes allocated and not freed (an int64_t)
+
+    // GxB_Global_Option_get/set only:
+    GxB_MEMORY_PEAK = 26    // high-water mark of GxB_MEMORY_INUSE (an int64_t)
 
 } GxB_Option_Field ;
 
@@ -3322,6 +3348,15 @@ typedef enum
 }
 GxB_Format_Value ;
 
+// GxB_NUMA can be one of the following:
+typedef enum
+{
+    GxB_NUMA_NONE = 0,          // pages are placed by the OS (default)
+    GxB_NUMA_FIRST_TOUCH = 1,   // each thread first touches its own slice
+    GxB_NUMA_INTERLEAVE = 2     // pages are interleaved across all nodes
+}
+GxB_NUMA_Policy ;
+
 // GxB_THREAD_SAFETY and GxB_THREADING can be one of the following:
 typedef enum
 {
@@ -3398,6 +3433,79 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
     ...                             // return value of the global option
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Stats: per-operation telemetry
+//------------------------------------------------------------------------------
+
+// After GxB_set (GxB_STATS, true), each mxm, select, reduce to scalar, build
+// and wait appends a GxB_Stats record to a log that holds the most recent
+// GxB_STATS_LOG_SIZE records.  The waits include those done internally, on
+// matrices with pending tuples or zombies.  An operation that returns an
+// error is not recorded.  The log is read with GxB_Stats_get and emptied with
+// GxB_Stats_clear.  Recording is disabled by default.
+
+#define GxB_STATS_LOG_SIZE 4096
+
+typedef enum
+{
+    GxB_STATS_MXM = 0,      // GrB_mxm, GrB_vxm and GrB_mxv
+    GxB_STATS_SELECT = 1,   // GxB_select
+    GxB_STATS_REDUCE = 2,   // GrB_reduce to a scalar
+    GxB_STATS_BUILD = 3,    // GrB_Matrix_build and GrB_Vector_build
+    GxB_STATS_WAIT = 4      // assembly of pending tuples and zombies
+}
+GxB_Stats_Op ;
+
+typedef struct
+{
+    GxB_Stats_Op op ;       // the operation
+    GrB_Desc_Value method ; // mxm: GxB_AxB_GUSTAVSON, GxB_AxB_HEAP or
+                            // GxB_AxB_DOT.  GxB_DEFAULT otherwise.
+    int nthreads ;          // # of threads used by the kernel
+    int ntasks ;            // # of parallel tasks of the kernel
+    double flops ;          // mxm: # of multiply-adds, counted only where
+                            // the mask allows for the masked dot product
+                            // method.  Otherwise the # of entries
+                            // processed.  Zero if not known.
+    int64_t bytes ;         // # of bytes allocated during the operation
+    int64_t anz ;           // # of entries in the input A (mxm, select,
+                            // reduce, or the matrix of a wait)
+    int64_t bnz ;           // # of entries in the input B of an mxm
+    int64_t mnz ;           // # of entries in the mask, zero if none
+    int64_t cnz ;           // # of entries in the result matrix C, zero for
+                            // a reduce to scalar
+    double time ;           // wall-clock time of the operation, in seconds
+}
+GxB_Stats ;
+
+GrB_Info GxB_Stats_get      // get the most recent per-operation records
+(
+    GxB_Stats *stats,       // array of size *nstats, oldest record first
+    GrB_Index *nstats       // input: size of stats, output: # of records
+) ;
+
+GrB_Info GxB_Stats_clear    // empty the log of per-operation records
+(
+    void
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_Trace_write: trace of the internal phases
+//------------------------------------------------------------------------------
+
+// If GraphBLAS is compiled with -DGBTRACE (cmake -DGBTRACE=1), the start and
+// end of each internal phase (GB_wait, the selector phases, the dot3 slicing,
+// each parallel task of the multiply and reduce kernels, ...) is recorded
+// with the id of the thread that ran it.  GxB_Trace_write writes the trace in
+// the Chrome trace event format (chrome://tracing or ui.perfetto.dev), and
+// clears it.  Otherwise the tracing compiles to nothing, and GxB_Trace_write
+// returns GrB_INVALID_VALUE.
+
+GrB_Info GxB_Trace_write    // write the trace to a file, and clear it
+(
+    const char *filename    // name of the file, in Chrome trace event format
+) ;
+
 //==============================================================================
 // === GxB_set and GxB_get =====================================================
 //==============================================================================
@@ -3421,9 +3529,26 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      // see the GxB_NTHREADS_MAX discussion above
 //      GxB_set (GxB_NTHREADS, nthreads_max) ;
 //      GxB_get (GxB_NTHREADS, int *nthreads_max) ;
+//
+//      GxB_set (GxB_STATS, bool stats) ;
+//      GxB_get (GxB_STATS, bool *stats) ;
+//
+//      GxB_set (GxB_MEMORY_PEAK, 0) ;
+//      GxB_get (GxB_MEMORY_PEAK, int64_t *peak) ;
+
+// GxB_MEMORY_INUSE is the # of bytes allocated by GraphBLAS, by all threads,
+// and not yet freed.  GxB_MEMORY_PEAK is its largest value since GrB_init or
+// since the last GxB_set (GxB_MEMORY_PEAK, 0), which resets it to the current
+// GxB_MEMORY_INUSE.  Both are always computed.  To keep the cost low, each
+// thread collects small allocations and frees and adds them to the total once
+// they reach 64KB, so both values can be off by up to 64KB per thread.  The
+// workspace arena (GxB_ARENA) is not included.  The arrays of a matrix count
+// while GraphBLAS owns them: GxB_*_export removes them from GxB_MEMORY_INUSE,
+// and GxB_*_import adds the arrays of the user.
 
 // To get global options that can be queried but not modified:
 //
+//      GxB_get (GxB_MEMORY_INUSE,  int64_t *inuse) ;
 //      GxB_get (GxB_MODE,          GrB_Mode *mode) ;
 //      GxB_get (GxB_THREAD_SAFETY, GxB_Thread_Model *thread_safety) ;
 //      GxB_get (GxB_THREADING,     GxB_Thread_Model *threading) ;
@@ -3450,6 +3575,8 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //
 //      GxB_set (GrB_Descriptor d, GrB_MASK, GxB_DEFAULT) ;
 //      GxB_set (GrB_Descriptor d, GrB_MASK, GrB_SCMP) ;
+//      GxB_set (GrB_Descriptor d, GrB_MASK, GxB_STRUCTURE) ;
+//      GxB_set (GrB_Descriptor d, GrB_MASK, GxB_STRUCT_COMP) ;
 //
 //      GxB_set (GrB_Descriptor d, GrB_INP0, GxB_DEFAULT) ;
 //      GxB_set (GrB_Descriptor d, GrB_INP0, GrB_TRAN ;
@@ -5083,6 +5210,57 @@ GrB_Info GxB_Matrix_select          // C<Mask> = accum (C, op(A,k)) or op(A',k)
     )                                               \
     (C, Mask, accum, op, A, Thunk, desc)
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_split_tri: split a matrix into its triangular and diagonal parts
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_split_tri computes L = tril (A,-1), D = diag (A), and
+// U = triu (A,1) in a single pass over A, which is faster than three calls to
+// GxB_select.  Any of L, D, and U may be NULL, in which case it is not
+// computed, but those that are present must be distinct.  Each output is
+// overwritten as if by GxB_select with no mask or accum operator, and is
+// typecast if its type differs from A.  If the descriptor transposes A, then
+// L = tril (A',-1), D = diag (A'), and U = triu (A',1) are computed instead.
+// A need not be square.  No other descriptor settings are used, except for
+// GxB_NTHREADS and GxB_CHUNK.
+
+GrB_Info GxB_Matrix_split_tri       // L=tril(A,-1), D=diag(A), U=triu(A,1)
+(
+    GrB_Matrix L,                   // output: strictly lower part, or NULL
+    GrB_Matrix D,                   // output: diagonal part, or NULL
+    GrB_Matrix U,                   // output: strictly upper part, or NULL
+    const GrB_Matrix A,             // input matrix
+    const GrB_Descriptor desc       // descriptor for A
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_tri_view: view the triangular parts of a matrix, with no copy
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_tri_view creates L = tril (A,-1) and U = triu (A,1) as views of
+// A.  A view is a new matrix that shares the indices and values of A, and
+// takes only O(n) memory of its own for an n-by-n matrix A.  Either L or U
+// may be NULL, in which case it is not created.  The views have the same type
+// and CSR/CSC format as A.
+
+// GrB_mxm, GrB_mxv, and GrB_vxm can use a view directly as the mask or an
+// input, if the mask is not complemented and the multiply uses the dot
+// product method with no transpose of the data structures (for example,
+// C<L> = L*U' with L, U, and C all held by row).  GrB_reduce to a scalar can
+// also use a view directly.  Any other use of a view first copies it into a
+// standard matrix, which then no longer depends on A.
+
+// A must not be modified or freed while any view of it exists, unless the
+// view has been used in a way that copies it.  Freeing a view with GrB_free
+// does not free A.
+
+GrB_Info GxB_Matrix_tri_view        // L = tril (A,-1) and U = triu (A,1)
+(
+    GrB_Matrix *L,                  // handle of view of tril (A,-1), or NULL
+    GrB_Matrix *U,                  // handle of view of triu (A,1), or NULL
+    const GrB_Matrix A              // matrix to view
+) ;
+
 //------------------------------------------------------------------------------
 // matrix and vector reduction
 //------------------------------------------------------------------------------
@@ -29,6 +29,10 @@
 // GraphBLAS will be slower:
 // #define GBCOMPACT 1
 
+// to record a trace of the internal phases for GxB_Trace_write, uncomment
+// this line, or use cmake -DGBTRACE=1:
+// #define GBTRACE 1
+
 // set these via cmake, or uncomment to select the user-thread model:
 
 // #define USER_POSIX_THREADS
@@ -793,6 +797,11 @@ typedef struct
     int nthreads_max ;          // max # of threads to use
     const char *where ;         // GraphBLAS function where error occurred
     char details [GB_DLEN] ;    // error report
+    // telemetry of the kernel of the current operation (see GB_stats.c)
+    int stats_method ;          // kernel selected (GxB_AxB_* for mxm)
+    int stats_nthreads ;        // # of threads used by the kernel
+    int stats_ntasks ;          // # of parallel tasks of the kernel
+    double stats_flops ;        // flops or # of entries processed
 }
 GB_Context_struct ;
 
@@ -822,7 +831,12 @@ typedef GB_Context_struct *GB_Context ;
     Context->where = where_string ;                                 \
     /* get the default max # of threads and default chunk size */   \
     Context->nthreads_max = GB_Global_nthreads_max_get ( ) ;        \
-    Context->chunk = GB_Global_chunk_get ( ) ;
+    Context->chunk = GB_Global_chunk_get ( ) ;                      \
+    /* no kernel has run yet */                                     \
+    Context->stats_method = GxB_DEFAULT ;                           \
+    Context->stats_nthreads = 0 ;                                   \
+    Context->stats_ntasks = 0 ;                                     \
+    Context->stats_flops = 0 ;
 
 #define GB_WHERE(where_string)                                      \
     if (!GB_Global_GrB_init_called_get ( ))                         \
@@ -832,6 +846,91 @@ typedef GB_Context_struct *GB_Context ;
     }                                                               \
     GB_CONTEXT (where_string) ;
 
+//------------------------------------------------------------------------------
+// GB_stats: per-operation telemetry
+//------------------------------------------------------------------------------
+
+// An operation that is recorded in the GxB_Stats log calls GB_stats_begin when
+// it starts and GB_stats_end when it succeeds.  In between, its kernel
+// reports what it did with GB_STATS_KERNEL.  The mark saves the kernel
+// telemetry of an enclosing operation, so that an operation can be nested
+// inside another (a GB_wait inside GB_mxm, for example).
+
+typedef struct
+{
+    bool on ;                   // true if GxB_STATS was enabled at the start
+    double time ;               // time at the start of the operation
+    int64_t bytes ;             // # of bytes allocated before the operation
+    int64_t anz ;               // # of entries in the inputs, at the start
+    int64_t bnz ;
+    int64_t mnz ;
+    int method ;                // kernel telemetry of the enclosing operation
+    int nthreads ;
+    int ntasks ;
+    double flops ;
+}
+GB_Stats_mark ;
+
+void GB_stats_begin
+(
+    GB_Stats_mark *mark,        // mark to start
+    const GrB_Matrix A,         // inputs of the operation, each may be NULL
+    const GrB_Matrix B,
+    const GrB_Matrix M,         // mask of the operation, NULL if none
+    GB_Context Context
+) ;
+
+void GB_stats_end
+(
+    GB_Stats_mark *mark,        // mark from GB_stats_begin
+    GxB_Stats_Op op,            // operation to record
+    const GrB_Matrix C,         // result of the operation, may be NULL
+    GB_Context Context
+) ;
+
+#define GB_STATS_KERNEL(method,nthreads,ntasks,flops)                   \
+{                                                                       \
+    if (Context != NULL)                                                \
+    {                                                                   \
+        Context->stats_method = (method) ;                              \
+        Context->stats_nthreads = (nthreads) ;                          \
+        Context->stats_ntasks = (ntasks) ;                              \
+        Context->stats_flops = (double) (flops) ;                       \
+    }                                                                   \
+}
+
+//------------------------------------------------------------------------------
+// GB_trace: trace of the internal phases
+//------------------------------------------------------------------------------
+
+// If GraphBLAS is compiled with -DGBTRACE, GB_TRACE_BEGIN and GB_TRACE_END
+// record the start and end of an internal phase or parallel task, by the
+// calling thread, for GxB_Trace_write.  The name must be a string literal.
+// Otherwise they are empty.
+
+#ifdef GBTRACE
+
+void GB_trace_event
+(
+    const char *name,           // name of the phase, a string literal
+    char phase                  // 'B' to begin the phase, 'E' to end it
+) ;
+
+bool GB_trace_write             // write and clear the trace
+(
+    FILE *f                     // file to write the trace to
+) ;
+
+#define GB_TRACE_BEGIN(name) GB_trace_event (name, 'B')
+#define GB_TRACE_END(name)   GB_trace_event (name, 'E')
+
+#else
+
+#define GB_TRACE_BEGIN(name)
+#define GB_TRACE_END(name)
+
+#endif
+
 //------------------------------------------------------------------------------
 // GB_GET_NTHREADS_MAX:  determine max # of threads for OpenMP parallelism.
 //------------------------------------------------------------------------------
@@ -1242,6 +1341,16 @@ void GB_memcpy                  // parallel memcpy
     int nthreads                // # of threads to use
 ) ;
 
+// size of the pages touched by GB_numa_place and GB_hugepage_malloc
+#define GB_NUMA_PAGE 4096
+
+void GB_numa_place              // place a new array on the NUMA nodes
+(
+    void *p,                    // array to place
+    size_t n,                   // size of the array, in bytes
+    int nthreads                // # of threads that will use the array
+) ;
+
 GrB_Info GB_nvals           // get the number of entries in a matrix
 (
     GrB_Index *nvals,       // matrix has nvals entries
@@ -1295,6 +1404,12 @@ void GB_ph_free                 // free A->p and A->h of a matrix
     GrB_Matrix A                // matrix with content to free
 ) ;
 
+GrB_Info GB_ph_unshare          // make A->p and A->h private to A
+(
+    GrB_Matrix A,               // matrix that may share A->p and A->h
+    GB_Context Context
+) ;
+
 // free all content, and return if critical section fails
 #define GB_PHIX_FREE(A)                                                     \
 {                                                                           \
@@ -1380,7 +1495,8 @@ typedef struct          // task descriptor
 GB_task_struct ;
 
 // GB_REALLOC_TASK_LIST: Allocate or reallocate the TaskList so that it can
-// hold at least ntasks.  Double the size if it's too small.
+// hold at least ntasks.  Double the size if it's too small.  The TaskList is
+// workspace, so it is taken from the arena if enabled (see GB_arena.c).
 
 #define GB_REALLOC_TASK_LIST(TaskList,ntasks,max_ntasks)                \
 {                                                                       \
@@ -1389,7 +1505,7 @@ GB_task_struct ;
         bool ok ;                                                       \
         int nold = (max_ntasks == 0) ? 0 : (max_ntasks + 1) ;           \
         int nnew = 2 * (ntasks) + 1 ;                                   \
-        GB_REALLOC_MEMORY (TaskList, nnew, nold,                        \
+        GB_ARENA_REALLOC (TaskList, nnew, nold,                         \
             sizeof (GB_task_struct), &ok) ;                             \
         if (!ok)                                                        \
         {                                                               \
@@ -1451,6 +1567,7 @@ void GB_slice_vector
     const int64_t pA_end,           // A(:,kA) ends at pA_end-1 in Ai,Ax
     const int64_t *restrict Ai,     // indices of A
     const int64_t A_hfirst,         // if Ai is an implicit hyperlist
+    const int64_t A_nzombies,       // # of zombies in Ai (GB_add for GB_wait)
     const int64_t pB_start,         // B(:,kB) starts at pB_start in Bi,Bx
     const int64_t pB_end,           // B(:,kB) ends at pB_end-1 in Bi,Bx
     const int64_t *restrict Bi,     // indices of B
@@ -1540,6 +1657,29 @@ void GB_free_memory
     size_t size_of_item     // sizeof each item
 ) ;
 
+// workspace arena (see GB_arena.c)
+#include "GB_arena.h"
+
+// transparent huge pages (see GB_hugepage.c)
+#define GB_HUGEPAGE_SIZE ((size_t) 2 * 1024 * 1024)
+
+void *GB_hugepage_malloc    // pointer to allocated block of memory
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    bool do_calloc          // if true, set the space to zero
+) ;
+
+bool GB_hugepage_owns       // true if p was allocated on huge pages
+(
+    void *p                 // block to check
+) ;
+
+void GB_hugepage_untrack    // remove a huge-page block from the statistics
+(
+    void *p                 // block about to be freed
+) ;
+
 //------------------------------------------------------------------------------
 // macros to create/free matrices, vectors, and generic memory
 //------------------------------------------------------------------------------
@@ -1618,6 +1758,22 @@ void GB_free_memory
     p = GB_realloc_memory (nnew, nold, s, (void *) p, ok) ;                   \
 }
 
+#define GB_ARENA_MALLOC(p,n,s)                                                \
+    printf ("\nArena malloc:                 "                                \
+    "%s = malloc (%s = "GBd", %s = "GBd") line %d file %s\n",                 \
+    GB_STR(p), GB_STR(n), (int64_t) n, GB_STR(s), (int64_t) s,                \
+    __LINE__,__FILE__) ;                                                      \
+    p = GB_arena_malloc (n, s) ;
+
+#define GB_ARENA_REALLOC(p,nnew,nold,s,ok)                                    \
+{                                                                             \
+    printf ("\nArena realloc: %14p "                                          \
+    "%s = realloc (%s = "GBd", %s = "GBd", %s = "GBd") line %d file %s\n",    \
+    p, GB_STR(p), GB_STR(nnew), (int64_t) nnew, GB_STR(nold), (int64_t) nold, \
+    GB_STR(s), (int64_t) s, __LINE__,__FILE__) ;                              \
+    p = GB_arena_realloc (nnew, nold, s, (void *) p, ok) ;                    \
+}
+
 #define GB_FREE_MEMORY(p,n,s)                                                 \
 {                                                                             \
     if (p)                                                                    \
@@ -1661,6 +1817,12 @@ void GB_free_memory
 #define GB_REALLOC_MEMORY(p,nnew,nold,s,ok)                                   \
     p = GB_realloc_memory (nnew, nold, s, (void *) p, ok) ;
 
+#define GB_ARENA_MALLOC(p,n,s)                                                \
+    p = GB_arena_malloc (n, s) ;
+
+#define GB_ARENA_REALLOC(p,nnew,nold,s,ok)                                    \
+    p = GB_arena_realloc (nnew, nold, s, (void *) p, ok) ;
+
 #define GB_FREE_MEMORY(p,n,s)                                                 \
 {                                                                             \
     GB_free_memory ((void *) p, n, s) ;                                       \
@@ -1748,6 +1910,7 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
     const GrB_Descriptor desc,  // descriptor to query, may be NULL
     bool *C_replace,            // if true replace C before C<M>=Z
     bool *Mask_comp,            // if true use logical negation of M
+    bool *Mask_struct,          // if true use only the pattern of M
     bool *In0_transpose,        // if true transpose first input
     bool *In1_transpose,        // if true transpose second input
     GrB_Desc_Value *AxB_method, // method for C=A*B
@@ -1853,6 +2016,12 @@ GrB_Info GB_wait                // finish all pending computations
     GB_Context Context
 ) ;
 
+GrB_Info GB_view_materialize    // copy a view into a standard matrix
+(
+    GrB_Matrix A,               // view to convert, in place
+    GB_Context Context
+) ;
+
 //------------------------------------------------------------------------------
 // OpenMP definitions
 //------------------------------------------------------------------------------
@@ -1897,6 +2066,14 @@ GrB_Info GB_wait                // finish all pending computations
 // GB_CRITICAL: GB_queue_* inside a critical section, which 'cannot' fail
 #define GB_CRITICAL(op) if (!(op)) GB_PANIC ;
 
+// The queue is split into GB_QUEUE_NSHARDS shards, each with its own lock
+// (see GB_Global.c).  GB_QUEUE_SHARD(A) is the shard that holds the matrix A,
+// from a Fibonacci hash of the address of its header.
+#define GB_QUEUE_LOG2_NSHARDS 6
+#define GB_QUEUE_NSHARDS (1 << GB_QUEUE_LOG2_NSHARDS)
+#define GB_QUEUE_SHARD(A) ((int) ((((uint64_t) (A)) * 0x9E3779B97F4A7C15ULL) \
+    >> (64 - GB_QUEUE_LOG2_NSHARDS)))
+
 bool GB_queue_remove            // remove matrix from queue
 (
     GrB_Matrix A                // matrix to remove
@@ -1915,7 +2092,7 @@ bool GB_queue_remove_head       // remove matrix at the head of queue
 bool GB_queue_status            // get the queue status of a matrix
 (
     GrB_Matrix A,               // matrix to check
-    GrB_Matrix *p_head,         // head of the queue
+    GrB_Matrix *p_head,         // head of the shard of the queue holding A
     GrB_Matrix *p_prev,         // prev from A
     GrB_Matrix *p_next,         // next after A
     bool *p_enqd                // true if A is in the queue
@@ -2090,12 +2267,13 @@ extern mtx_t GB_sync ;
 
 // check the descriptor and extract its contents; also copies
 // nthreads_max and chunk from the descriptor to the Context
-#define GB_GET_DESCRIPTOR(info,desc,dout,dm,d0,d1,dalgo)                     \
+#define GB_GET_DESCRIPTOR(info,desc,dout,dm,dms,d0,d1,dalgo)                 \
     GrB_Info info ;                                                          \
-    bool dout, dm, d0, d1 ;                                                  \
+    bool dout, dm, dms, d0, d1 ;                                             \
     GrB_Desc_Value dalgo ;                                                   \
     /* if desc is NULL then defaults are used.  This is OK */                \
-    info = GB_Descriptor_get (desc, &dout, &dm, &d0, &d1, &dalgo, Context) ; \
+    info = GB_Descriptor_get (desc, &dout, &dm, &dms, &d0, &d1, &dalgo,      \
+        Context) ;                                                           \
     if (info != GrB_SUCCESS)                                                 \
     {                                                                        \
         /* desc not NULL, but uninitialized or an invalid object */          \
@@ -2165,6 +2343,13 @@ extern mtx_t GB_sync ;
 // true if a matrix has pending tuples or zombies
 #define GB_PENDING_OR_ZOMBIES(A) (GB_PENDING (A) || GB_ZOMBIES (A))
 
+// true if a matrix is a view of another matrix (see GxB_Matrix_tri_view)
+#define GB_IS_VIEW(A) ((A) != NULL && (A)->e != NULL)
+
+// Ae [k] is the end of the kth vector of A: A->e [k] if A is a view, or
+// A->p [k+1] otherwise
+#define GB_VECTOR_ENDS(A) (GB_IS_VIEW (A) ? (A)->e : ((A)->p + 1))
+
 // do all pending updates:  delete zombies and assemble any pending tuples
 #define GB_WAIT_MATRIX(A)                                               \
 {                                                                       \
@@ -2179,8 +2364,16 @@ extern mtx_t GB_sync ;
     ASSERT (!GB_PENDING (A)) ;                                          \
 }
 
-// wait for any pending operations: both pending tuples and zombies
+// wait for any pending operations: both pending tuples and zombies.  A view
+// is copied into a standard matrix.
 #define GB_WAIT(A)                                                      \
+{                                                                       \
+    if (GB_PENDING_OR_ZOMBIES (A) || GB_IS_VIEW (A)) GB_WAIT_MATRIX (A) ; \
+}
+
+// same as GB_WAIT, except that a view is left as-is, for the methods that
+// can access it directly (GB_mxm and GB_reduce_to_scalar)
+#define GB_WAIT_KEEP_VIEW(A)                                            \
 {                                                                       \
     if (GB_PENDING_OR_ZOMBIES (A)) GB_WAIT_MATRIX (A) ;                 \
 }
@@ -2611,6 +2804,72 @@ static inline bool GB_lookup        // find j = Ah [k] in a hyperlist
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_lookup_view: find k so that j == Ah [k], in a matrix or a view
+//------------------------------------------------------------------------------
+
+// Same as GB_lookup, except that the kth vector ends at Ae [k] instead of
+// Ap [k+1].  Ae is GB_VECTOR_ENDS (A), so this works for any matrix A.
+
+static inline bool GB_lookup_view   // find j = Ah [k] in a hyperlist
+(
+    const bool A_is_hyper,          // true if A is hypersparse
+    const int64_t *restrict Ah,     // A->h [0..A->nvec-1]: list of vectors
+    const int64_t *restrict Ap,     // A->p [0..A->nvec-1]: start of vectors
+    const int64_t *restrict Ae,     // Ae [0..A->nvec-1]: end of vectors
+    int64_t *restrict pleft,        // look only in A->h [pleft..pright]
+    int64_t pright,                 // normally A->nvec-1, but can be trimmed
+    const int64_t j,                // vector to find, as j = Ah [k]
+    int64_t *restrict pstart,       // start of vector: Ap [k]
+    int64_t *restrict pend          // end of vector: Ae [k]
+)
+{
+    int64_t k = j ;
+    if (A_is_hyper)
+    {
+        bool found ;
+        GB_BINARY_SEARCH (j, Ah, (*pleft), pright, found) ;
+        if (!found)
+        { 
+            // j does not appear in the hyperlist Ah
+            (*pstart) = -1 ;
+            (*pend)   = -1 ;
+            return (false) ;
+        }
+        k = (*pleft) ;
+    }
+    // j appears as the kth vector of A
+    (*pstart) = Ap [k] ;
+    (*pend)   = Ae [k] ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mcast: get the value of M(i,j), typecasted to boolean
+//------------------------------------------------------------------------------
+
+// M(i,j) is held in Mx [pM], or if Mx is NULL, the mask is structural (see
+// GxB_STRUCTURE) and M(i,j) is true since the entry is present.  Kernels that
+// support a structural mask set Mx = (Mask_struct ? NULL : M->x), so that the
+// values of the mask are neither read nor typecasted.
+
+static inline bool GB_mcast         // return M(i,j), typecasted to boolean
+(
+    const GB_void *restrict Mx,     // mask values, or NULL if structural
+    const int64_t pM,               // position of M(i,j)
+    const size_t msize,             // size of each entry of Mx
+    const GB_cast_function cast_M   // function to cast M(i,j) to bool
+)
+{
+    if (Mx == NULL)
+    {
+        // structural mask: M(i,j) is true if present
+        return (true) ;
+    }
+    bool mij ;
+    cast_M (&mij, Mx +(pM*msize), 0) ;
+    return (mij) ;
+}
 
 
 #define GB_PRAGMA(x) _Pragma (#x)
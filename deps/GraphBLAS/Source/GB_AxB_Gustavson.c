@@ -37,6 +37,7 @@ GrB_Info GB_AxB_Gustavson           // C=A*B or C<M>=A*B, Gustavson's method
     GrB_Matrix *Chandle,            // output matrix
     const GrB_Matrix M_in,          // optional matrix
     const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_Matrix A,             // input matrix A
     const GrB_Matrix B,             // input matrix B
     const GrB_Semiring semiring,    // semiring that defines C=A*B
@@ -233,7 +234,7 @@ GrB_Info GB_AxB_Gustavson           // C=A*B or C<M>=A*B, Gustavson's method
     // are created, and this function is not used.  All C=A*B computations
     // are done with the generic worker below.
 
-    info = GB_AxB_Gustavson_builtin (C, M, A, A_is_pattern,
+    info = GB_AxB_Gustavson_builtin (C, M, Mask_struct, A, A_is_pattern,
         B, B_is_pattern, semiring, flipxy, Sauna) ;
     ASSERT (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
     if (info == GrB_SUCCESS)
@@ -252,7 +253,7 @@ GrB_Info GB_AxB_Gustavson           // C=A*B or C<M>=A*B, Gustavson's method
     // user semirings created at compile time
     //--------------------------------------------------------------------------
 
-    if (semiring->object_kind == GB_USER_COMPILED)
+    if (semiring->object_kind == GB_USER_COMPILED && !Mask_struct)
     {
         // determine the required type of A and B for the user semiring
         GrB_Type atype_required, btype_required ;
@@ -21,6 +21,7 @@ GrB_Info GB_AxB_Gustavson_builtin
 (
     GrB_Matrix C,                   // output matrix
     const GrB_Matrix M,             // M matrix for C<M> (not complemented)
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_Matrix A,             // input matrix
     const bool A_is_pattern,        // true if only the pattern of A is used
     const GrB_Matrix B,             // input matrix
@@ -77,7 +78,7 @@ GrB_Info GB_AxB_Gustavson_builtin
 
     #define GB_AxB_WORKER(add,mult,xyname)                      \
     {                                                           \
-        info = GB_AXB (add,mult,xyname) (C, M,                  \
+        info = GB_AXB (add,mult,xyname) (C, M, Mask_struct,     \
             A, A_is_pattern, B, B_is_pattern, Sauna) ;          \
     }                                                           \
     break ;
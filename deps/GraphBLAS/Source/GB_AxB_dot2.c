@@ -34,6 +34,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
     GrB_Matrix *Chandle,            // output matrix
     const GrB_Matrix M,             // mask matrix for C<!M>=A'*B
                                     // if present, the mask is complemented
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_Matrix *Aslice,       // input matrices (already sliced)
     const GrB_Matrix B,             // input matrix
     const GrB_Semiring semiring,    // semiring that defines C=A*B
@@ -231,7 +232,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 
     #define GB_AxB_WORKER(add,mult,xyname)                              \
     {                                                                   \
-        info = GB_Adot2B (add,mult,xyname) (C, M,                       \
+        info = GB_Adot2B (add,mult,xyname) (C, M, Mask_struct,          \
             Aslice, A_is_pattern, B, B_is_pattern,                      \
             C_counts, nthreads, naslice, nbslice) ;                     \
         done = (info != GrB_NO_VALUE) ;                                 \
@@ -258,7 +259,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
     // user semirings created at compile time
     //--------------------------------------------------------------------------
 
-    if (semiring->object_kind == GB_USER_COMPILED)
+    if (semiring->object_kind == GB_USER_COMPILED && !Mask_struct)
     {
         // determine the required type of A and B for the user semiring
         GrB_Type atype_required, btype_required ;
@@ -10,11 +10,52 @@
 // This function only computes C<M>=A'*B.  The mask must be present, and not
 // complemented.  The mask is always applied.
 
+// Any of M, A, and B may be views (see GxB_Matrix_tri_view).  The kth vector
+// of a view X ends at X->e [k] instead of X->p [k+1], and the vectors need not
+// be contiguous, so the position of M(i,j) in M differs from that of C(i,j) in
+// C by Mp [k] - Cp [k].
+
 #include "GB_mxm.h"
 #ifndef GBCOMPACT
 #include "GB_AxB__include.h"
 #endif
 
+//------------------------------------------------------------------------------
+// GB_dot3_nmatches: # of indices common to two sorted lists
+//------------------------------------------------------------------------------
+
+// This is the # of multiply-adds of the dot product of two sparse vectors
+// with patterns Ai [pA..pA_end-1] and Bi [pB..pB_end-1].
+
+static inline int64_t GB_dot3_nmatches
+(
+    const int64_t *restrict Ai, int64_t pA, const int64_t pA_end,
+    const int64_t *restrict Bi, int64_t pB, const int64_t pB_end
+)
+{
+    int64_t nmatches = 0 ;
+    while (pA < pA_end && pB < pB_end)
+    {
+        int64_t ia = Ai [pA] ;
+        int64_t ib = Bi [pB] ;
+        if (ia < ib)
+        { 
+            pA++ ;
+        }
+        else if (ib < ia)
+        { 
+            pB++ ;
+        }
+        else
+        { 
+            nmatches++ ;
+            pA++ ;
+            pB++ ;
+        }
+    }
+    return (nmatches) ;
+}
+
 #define GB_FREE_WORK                                                    \
 {                                                                       \
     GB_FREE_MEMORY (TaskList, max_ntasks+1, sizeof (GB_task_struct)) ;  \
@@ -30,6 +71,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
 (
     GrB_Matrix *Chandle,            // output matrix
     const GrB_Matrix M,             // mask matrix
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_Matrix A,             // input matrix
     const GrB_Matrix B,             // input matrix
     const GrB_Semiring semiring,    // semiring that defines C=A*B
@@ -100,7 +142,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     const int64_t *restrict Mp = M->p ;
     const int64_t *restrict Mh = M->h ;
     const int64_t *restrict Mi = M->i ;
-    const GB_void *restrict Mx = M->x ;
+    const GB_void *restrict Mx = (Mask_struct ? NULL : M->x) ;
     const size_t msize = M->type->size ;
     const int64_t mvlen = M->vlen ;
     const int64_t mvdim = M->vdim ;
@@ -110,8 +152,9 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     GB_cast_function cast_M = GB_cast_factory (GB_BOOL_code, M->type->code) ;
 
     const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ae = GB_VECTOR_ENDS (A) ;
     const int64_t *restrict Ah = A->h ;
-    // const int64_t *restrict Ai = A->i ;
+    const int64_t *restrict Ai = A->i ;
     // const int64_t avlen = A->vlen ;
     // const int64_t avdim = A->vdim ;
     // const int64_t anz = GB_NNZ (A) ;
@@ -119,8 +162,9 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     const bool A_is_hyper = A->is_hyper ;
 
     const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Be = GB_VECTOR_ENDS (B) ;
     const int64_t *restrict Bh = B->h ;
-    // const int64_t *restrict Bi = B->i ;
+    const int64_t *restrict Bi = B->i ;
     // const int64_t bvlen = B->vlen ;
     // const int64_t bvdim = B->vdim ;
     // const int64_t bnz = GB_NNZ (B) ;
@@ -131,13 +175,20 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     // allocate C, the same size and # of entries as M
     //--------------------------------------------------------------------------
 
+    // C has the same pattern as M, so C->p and C->h are shallow copies of M->p
+    // and M->h, unless M is a view.  They are made private (see GB_ph_unshare)
+    // only if C is later modified in place, or transplanted into another
+    // matrix.  C->i and C->x are always allocated.
+
     GrB_Type ctype = add->op->ztype ;
     int64_t cvlen = mvlen ;
     int64_t cvdim = mvdim ;
     int64_t cnz = mnz ;
     int64_t cnvec = mnvec ;
+    bool C_shares_M = !GB_IS_VIEW (M) ;
 
-    GB_CREATE (Chandle, ctype, cvlen, cvdim, GB_Ap_malloc, true,
+    GB_CREATE (Chandle, ctype, cvlen, cvdim,
+        C_shares_M ? GB_Ap_null : GB_Ap_malloc, true,
         GB_SAME_HYPER_AS (M_is_hyper), M->hyper_ratio, cnvec,
         cnz+1,  // add one to cnz for GB_cumsum
         true, Context) ;
@@ -150,6 +201,15 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
 
     GrB_Matrix C = (*Chandle) ;
 
+    if (C_shares_M)
+    { 
+        C->p = M->p ;
+        C->h = M->h ;
+        C->p_shallow = true ;       // C->p not freed when freeing C
+        C->h_shallow = true ;       // C->h not freed when freeing C
+        C->plen = M->plen ;
+    }
+
     int64_t *restrict Cp = C->p ;
     int64_t *restrict Ch = C->h ;
     int64_t *restrict Cwork = C->i ;    // use C->i as workspace
@@ -162,18 +222,24 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
 
     //--------------------------------------------------------------------------
-    // copy Mp and Mh into C
+    // construct Cp and Ch if M is a view
     //--------------------------------------------------------------------------
 
-    // FUTURE:: C->p and C->h could be shallow copies of M->p and M->h, which
-    // could same some time and memory if C is then, say, transposed by
-    // GB_accum_mask later on.
-
-    nthreads = GB_nthreads (cnvec, chunk, nthreads_max) ;
-    GB_memcpy (Cp, Mp, (cnvec+1) * sizeof (int64_t), nthreads) ;
-    if (M_is_hyper)
-    { 
-        GB_memcpy (Ch, Mh, cnvec * sizeof (int64_t), nthreads) ;
+    if (!C_shares_M)
+    {
+        // C has the pattern of the view M, with its vectors made contiguous
+        const int64_t *restrict Me = M->e ;
+        nthreads = GB_nthreads (cnvec, chunk, nthreads_max) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (int64_t k = 0 ; k < cnvec ; k++)
+        { 
+            Cp [k] = Me [k] - Mp [k] ;
+        }
+        GB_cumsum (Cp, cnvec, NULL, nthreads) ;
+        if (M_is_hyper)
+        { 
+            GB_memcpy (Ch, Mh, cnvec * sizeof (int64_t), nthreads) ;
+        }
     }
     C->magic = GB_MAGIC ;
     C->nvec_nonempty = M->nvec_nonempty ;
@@ -183,18 +249,29 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     // construct the tasks for the first phase
     //--------------------------------------------------------------------------
 
+    // C is sliced instead of M, since C->p is the same as M->p, unless M is
+    // a view.  Only C->p is used, not the content of C.
     nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
     GB_OK (GB_AxB_dot3_one_slice (&TaskList, &max_ntasks, &ntasks, &nthreads,
-        M, Context)) ;
+        C, Context)) ;
 
     //--------------------------------------------------------------------------
     // phase1: estimate the work to compute each entry in C
     //--------------------------------------------------------------------------
 
-    // The work to compute C(i,j) is held in Cwork [p], if C(i,j) appears in
-    // as the pth entry in C.
+    // The work to compute C(i,j) is held in Cwork [pC], if C(i,j) appears in
+    // as the pC-th entry in C, and M(i,j) is the (pC+mshift)-th entry of M.
+
+    // The work is only an estimate.  If GxB_STATS is enabled, the actual # of
+    // multiply-adds is also counted, for the GxB_Stats record.  This is
+    // another merge of A(:,i) and B(:,j) for each entry of the mask.
 
-    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    const bool count_flops = GB_Global_stats_get ( ) ;
+    int64_t flops = 0 ;
+
+    GB_TRACE_BEGIN ("dot3 work") ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:flops)
     for (int taskid = 0 ; taskid < ntasks ; taskid++)
     {
 
@@ -226,14 +303,16 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
             //------------------------------------------------------------------
 
             int64_t j = (Mh == NULL) ? k : Mh [k] ;
-            GB_GET_VECTOR (pM, pM_end, pM, pM_end, Mp, k) ;
+            GB_GET_VECTOR (pC, pC_end, pM, pM_end, Cp, k) ;
+            int64_t mshift = Mp [k] - Cp [k] ;
 
             //------------------------------------------------------------------
             // get B(:,j)
             //------------------------------------------------------------------
 
             int64_t pB, pB_end ;
-            GB_lookup (B_is_hyper, Bh, Bp, &bpleft, bnvec-1, j, &pB, &pB_end) ;
+            GB_lookup_view (B_is_hyper, Bh, Bp, Be, &bpleft, bnvec-1, j,
+                &pB, &pB_end) ;
             int64_t bjnz = pB_end - pB ;
 
             //------------------------------------------------------------------
@@ -255,28 +334,33 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
                 // B(:,j) is empty, so C(:,j) is empty as well.  No work is to
                 // be done, but it still takes unit work to flag each C(:,j) as
                 // a zombie
-                for ( ; pM < pM_end ; pM++)
+                for ( ; pC < pC_end ; pC++)
                 { 
-                    Cwork [pM] = 1 ;
+                    Cwork [pC] = 1 ;
                 }
             }
             else
             {
                 int64_t apleft = 0 ;
-                for ( ; pM < pM_end ; pM++)
+                for ( ; pC < pC_end ; pC++)
                 {
                     int64_t work = 1 ;
-                    bool mij ;
-                    cast_M (&mij, Mx +(pM*msize), 0) ;
+                    int64_t pM = pC + mshift ;
+                    bool mij = GB_mcast (Mx, pM, msize, cast_M) ;
                     if (mij)
                     { 
                         int64_t pA, pA_end, i = Mi [pM] ;
-                        GB_lookup (A_is_hyper, Ah, Ap, &apleft, anvec-1, i,
-                            &pA, &pA_end) ;
+                        GB_lookup_view (A_is_hyper, Ah, Ap, Ae, &apleft,
+                            anvec-1, i, &pA, &pA_end) ;
                         int64_t ajnz = pA_end - pA ;
                         work += GB_IMIN (ajnz, bjnz) ;
+                        if (count_flops)
+                        { 
+                            flops += GB_dot3_nmatches (Ai, pA, pA_end,
+                                Bi, pB, pB_end) ;
+                        }
                     }
-                    Cwork [pM] = work ;
+                    Cwork [pC] = work ;
                 }
             }
         }
@@ -286,9 +370,15 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     // free the current tasks and construct the tasks for the second phase
     //--------------------------------------------------------------------------
 
+    GB_TRACE_END ("dot3 work") ;
     GB_FREE_MEMORY (TaskList, max_ntasks+1, sizeof (GB_task_struct)) ;
-    GB_OK (GB_AxB_dot3_slice (&TaskList, &max_ntasks, &ntasks, &nthreads,
-        C, Context)) ;
+    GB_TRACE_BEGIN ("GB_AxB_dot3_slice") ;
+    info = GB_AxB_dot3_slice (&TaskList, &max_ntasks, &ntasks, &nthreads,
+        C, Context) ;
+    GB_TRACE_END ("GB_AxB_dot3_slice") ;
+    GB_OK (info) ;
+
+    GB_STATS_KERNEL (GxB_AxB_DOT, nthreads, ntasks, flops) ;
 
     // if (ntasks > 1) printf ("ntasks %d\n", ntasks) ;
 
@@ -297,6 +387,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     //--------------------------------------------------------------------------
 
     bool done = false ;
+    GB_TRACE_BEGIN ("dot3 kernel") ;
 
 #ifndef GBCOMPACT
 
@@ -308,7 +399,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
 
     #define GB_AxB_WORKER(add,mult,xyname)                              \
     {                                                                   \
-        info = GB_Adot3B (add,mult,xyname) (C, M,                       \
+        info = GB_Adot3B (add,mult,xyname) (C, M, Mask_struct,          \
             A, A_is_pattern, B, B_is_pattern,                           \
             TaskList, ntasks, nthreads) ;                               \
         done = (info != GrB_NO_VALUE) ;                                 \
@@ -334,7 +425,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     // user semirings created at compile time
     //--------------------------------------------------------------------------
 
-    if (semiring->object_kind == GB_USER_COMPILED)
+    if (semiring->object_kind == GB_USER_COMPILED && !Mask_struct)
     { 
         // determine the required type of A and B for the user semiring
         GrB_Type atype_required, btype_required ;
@@ -476,6 +567,8 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
         }
     }
 
+    GB_TRACE_END ("dot3 kernel") ;
+
     //--------------------------------------------------------------------------
     // free workspace and return result
     //--------------------------------------------------------------------------
@@ -43,6 +43,7 @@ GrB_Info GB_AxB_dot_parallel        // parallel dot product
     GrB_Matrix *Chandle,            // output matrix, NULL on input
     GrB_Matrix M,                   // optional mask matrix
     const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_Matrix A,             // input matrix A
     const GrB_Matrix B,             // input matrix B
     const GrB_Semiring semiring,    // semiring that defines C=A*B
@@ -75,7 +76,8 @@ GrB_Info GB_AxB_dot_parallel        // parallel dot product
 
         // use dot3 if M is present and not complemented
         (*mask_applied) = true ;
-        return (GB_AxB_dot3 (Chandle, M, A, B, semiring, flipxy, Context)) ;
+        return (GB_AxB_dot3 (Chandle, M, Mask_struct, A, B, semiring, flipxy,
+            Context)) ;
 
     }
     else
@@ -125,10 +127,13 @@ GrB_Info GB_AxB_dot_parallel        // parallel dot product
         if (nthreads == 1)
         { 
             // do the entire computation with a single thread
+            GB_STATS_KERNEL (GxB_AxB_DOT, 1, 1, 0) ;
             GrB_Matrix Aslice [1] ;
             Aslice [0] = A ;
-            info = GB_AxB_dot2 (Chandle, M, Aslice, B, semiring, flipxy,
-                mask_applied, 1, 1, 1, NULL) ;
+            GB_TRACE_BEGIN ("GB_AxB_dot2") ;
+            info = GB_AxB_dot2 (Chandle, M, Mask_struct, Aslice, B, semiring,
+                flipxy, mask_applied, 1, 1, 1, NULL) ;
+            GB_TRACE_END ("GB_AxB_dot2") ;
             if (info == GrB_SUCCESS)
             { 
                 ASSERT_OK (GB_check (*Chandle, "C for sequential A*B", GB0)) ;
@@ -208,8 +213,12 @@ GrB_Info GB_AxB_dot_parallel        // parallel dot product
         // compute each slice of C = A'*B or C<!M> = A'*B
         //----------------------------------------------------------------------
 
-        GB_OK (GB_AxB_dot2 (Chandle, M, Aslice, B, semiring, flipxy,
-            mask_applied, nthreads, naslice, nbslice, Context)) ;
+        GB_STATS_KERNEL (GxB_AxB_DOT, nthreads, naslice * nbslice, 0) ;
+        GB_TRACE_BEGIN ("GB_AxB_dot2") ;
+        info = GB_AxB_dot2 (Chandle, M, Mask_struct, Aslice, B, semiring,
+            flipxy, mask_applied, nthreads, naslice, nbslice, Context) ;
+        GB_TRACE_END ("GB_AxB_dot2") ;
+        GB_OK (info) ;
 
         //----------------------------------------------------------------------
         // free workspace and return result
@@ -23,6 +23,7 @@ GrB_Info GB_AxB_heap                // C<M>=A*B or C=A*B using a heap
     GrB_Matrix *Chandle,            // output matrix
     const GrB_Matrix M_in,          // mask matrix for C<M>=A*B
     const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_Matrix A,             // input matrix
     const GrB_Matrix B,             // input matrix
     const GrB_Semiring semiring,    // semiring that defines C=A*B
@@ -158,6 +159,7 @@ GrB_Info GB_AxB_heap                // C<M>=A*B or C=A*B using a heap
     #define GB_AxB_WORKER(add,mult,xyname)                  \
     {                                                       \
         info = GB_AheapB (add,mult,xyname) (Chandle, M,     \
+            Mask_struct,                                    \
             A, A_is_pattern, B, B_is_pattern,               \
             List, pA_pair, Heap, bjnz_max) ;                \
         done = (info != GrB_NO_VALUE) ;                     \
@@ -190,7 +192,7 @@ GrB_Info GB_AxB_heap                // C<M>=A*B or C=A*B using a heap
     // user semirings created at compile time
     //--------------------------------------------------------------------------
 
-    if (semiring->object_kind == GB_USER_COMPILED)
+    if (semiring->object_kind == GB_USER_COMPILED && !Mask_struct)
     {
         // determine the required type of A and B for the user semiring
         GrB_Type atype_required, btype_required ;
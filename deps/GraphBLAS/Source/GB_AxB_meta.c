@@ -39,6 +39,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     GrB_Matrix *MT_handle,          // return MT = M' to caller, if computed
     const GrB_Matrix M_in,          // mask for C<M> (not complemented)
     const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_Matrix A_in,          // input matrix
     const GrB_Matrix B_in,          // input matrix
     const GrB_Semiring semiring,    // semiring that defines C=A*B
@@ -203,6 +204,23 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     ASSERT_OK (GB_check (A, "final A for A*B", GB0)) ;
     ASSERT_OK (GB_check (B, "final B for A*B", GB0)) ;
 
+    //--------------------------------------------------------------------------
+    // copy any views into standard matrices, unless GB_AxB_dot3 is used
+    //--------------------------------------------------------------------------
+
+    // A view (see GxB_Matrix_tri_view) can be used as-is only by GB_AxB_dot3,
+    // which computes C<M>=A'*B with no explicit transpose of M, A, or B.
+
+    bool views_ok = (M_in != NULL && !Mask_comp && !M_transpose && atrans
+        && !btrans
+        && (AxB_method == GxB_DEFAULT || AxB_method == GxB_AxB_DOT)) ;
+    if (!views_ok)
+    {
+        if (GB_IS_VIEW (M_in)) GB_OK (GB_wait (M_in, Context)) ;
+        if (GB_IS_VIEW (A_in)) GB_OK (GB_wait (A_in, Context)) ;
+        if (GB_IS_VIEW (B_in)) GB_OK (GB_wait (B_in, Context)) ;
+    }
+
     //--------------------------------------------------------------------------
     // explicitly transpose the mask
     //--------------------------------------------------------------------------
@@ -366,17 +384,17 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         else if (do_adotb)
         { 
             // C<M> = A'*B via dot product method
-            GB_OK (GB_AxB_dot_parallel (Chandle, M, Mask_comp, A, B, semiring,
-                flipxy, mask_applied, Context)) ;
+            GB_OK (GB_AxB_dot_parallel (Chandle, M, Mask_comp, Mask_struct,
+                A, B, semiring, flipxy, mask_applied, Context)) ;
             (*AxB_method_used) = GxB_AxB_DOT ;
         }
         else
         { 
             // C<M> = A'*B via saxpy: Gustavson or heap method
             GB_OK (GB_transpose (&AT, atype_required, true, A, NULL, Context)) ;
-            GB_OK (GB_AxB_saxpy_parallel (Chandle, M, Mask_comp, AT, B,
-                semiring, flipxy, AxB_method, AxB_method_used, mask_applied,
-                Context)) ;
+            GB_OK (GB_AxB_saxpy_parallel (Chandle, M, Mask_comp, Mask_struct,
+                AT, B, semiring, flipxy, AxB_method, AxB_method_used,
+                mask_applied, Context)) ;
         }
 
     }
@@ -403,17 +421,17 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // C<M> = A*B' via dot product
             GB_OK (GB_transpose (&AT, atype_required, true, A, NULL, Context)) ;
             GB_OK (GB_transpose (&BT, btype_required, true, B, NULL, Context)) ;
-            GB_OK (GB_AxB_dot_parallel (Chandle, M, Mask_comp, AT, BT, semiring,
-                flipxy, mask_applied, Context)) ;
+            GB_OK (GB_AxB_dot_parallel (Chandle, M, Mask_comp, Mask_struct,
+                AT, BT, semiring, flipxy, mask_applied, Context)) ;
             (*AxB_method_used) = GxB_AxB_DOT ;
         }
         else
         { 
             // C<M> = A*B' via saxpy: Gustavson or heap method
             GB_OK (GB_transpose (&BT, btype_required, true, B, NULL, Context)) ;
-            GB_OK (GB_AxB_saxpy_parallel (Chandle, M, Mask_comp, A, BT,
-                semiring, flipxy, AxB_method, AxB_method_used, mask_applied,
-                Context)) ;
+            GB_OK (GB_AxB_saxpy_parallel (Chandle, M, Mask_comp, Mask_struct,
+                A, BT, semiring, flipxy, AxB_method, AxB_method_used,
+                mask_applied, Context)) ;
         }
 
     }
@@ -438,16 +456,16 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         { 
             // C<M> = A*B via dot product
             GB_OK (GB_transpose (&AT, atype_required, true, A, NULL, Context)) ;
-            GB_OK (GB_AxB_dot_parallel (Chandle, M, Mask_comp, AT, B, semiring,
-                flipxy, mask_applied, Context)) ;
+            GB_OK (GB_AxB_dot_parallel (Chandle, M, Mask_comp, Mask_struct,
+                AT, B, semiring, flipxy, mask_applied, Context)) ;
             (*AxB_method_used) = GxB_AxB_DOT ;
         }
         else
         { 
             // C<M> = A*B via saxpy: Gustavson or heap method
-            GB_OK (GB_AxB_saxpy_parallel (Chandle, M, Mask_comp, A, B,
-                semiring, flipxy, AxB_method, AxB_method_used, mask_applied,
-                Context)) ;
+            GB_OK (GB_AxB_saxpy_parallel (Chandle, M, Mask_comp, Mask_struct,
+                A, B, semiring, flipxy, AxB_method, AxB_method_used,
+                mask_applied, Context)) ;
         }
     }
 
@@ -478,10 +496,18 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         // return MT to the caller, if computed and the caller wants it
         (*MT_handle) = MT ;
     }
-    else
+    else if (MT != NULL)
     { 
-        // otherwise, free it
+        // otherwise, free it.  C may share the pattern of MT (see
+        // GB_AxB_dot3), so C->p and C->h are made private to C first.
+        info = GB_ph_unshare (C, Context) ;
         GB_MATRIX_FREE (&MT) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_MATRIX_FREE (Chandle) ;
+            return (info) ;
+        }
     }
 
     return (GrB_SUCCESS) ;
@@ -71,6 +71,7 @@ GrB_Info GB_AxB_saxpy_parallel      // parallel matrix-matrix multiply
     GrB_Matrix *Chandle,            // output matrix, NULL on input
     GrB_Matrix M,                   // optional mask matrix
     const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_Matrix A,             // input matrix A
     const GrB_Matrix B,             // input matrix B
     const GrB_Semiring semiring,    // semiring that defines C=A*B
@@ -139,6 +140,26 @@ GrB_Info GB_AxB_saxpy_parallel      // parallel matrix-matrix multiply
         int64_t bjnz_max ;
         GB_AxB_select (A, B, semiring, AxB_method, AxB_method_used, &bjnz_max) ;
 
+        // the sequential method does not need the flop count; it is only
+        // computed for GxB_Stats_get, and its workspace is not charged to
+        // the operation
+        double flops = 0 ;
+        if (GB_Global_stats_get ( ))
+        {
+            int64_t *restrict Wflops = NULL ;
+            GB_CALLOC_MEMORY (Wflops, bnvec+1, sizeof (int64_t)) ;
+            if (Wflops != NULL)
+            { 
+                GB_AxB_flopcount (Wflops, NULL, (Mask_comp) ? NULL : M, A, B,
+                    0, Context) ;
+                flops = (double) Wflops [bnvec] ;
+                GB_FREE_MEMORY (Wflops, bnvec+1, sizeof (int64_t)) ;
+                GB_Global_stats_bytes_increment
+                    (-(int64_t) ((bnvec+1) * sizeof (int64_t))) ;
+            }
+        }
+        GB_STATS_KERNEL (*AxB_method_used, 1, 1, flops) ;
+
         // acquire a Sauna if Gustavson's method is being used
         int Sauna_id = -2 ;
         if (*AxB_method_used == GxB_AxB_GUSTAVSON)
@@ -147,9 +168,9 @@ GrB_Info GB_AxB_saxpy_parallel      // parallel matrix-matrix multiply
         }
 
         // C<M>=A*B
-        GrB_Info info1 = GB_AxB_saxpy_sequential (Chandle, M, Mask_comp, A, B,
-            semiring, flipxy, *AxB_method_used, bjnz_max, true, mask_applied,
-            Sauna_id) ;
+        GrB_Info info1 = GB_AxB_saxpy_sequential (Chandle, M, Mask_comp,
+            Mask_struct, A, B, semiring, flipxy, *AxB_method_used, bjnz_max,
+            true, mask_applied, Sauna_id) ;
 
         // release the Sauna for Gustavson's method
         if (*AxB_method_used == GxB_AxB_GUSTAVSON)
@@ -333,6 +354,8 @@ GrB_Info GB_AxB_saxpy_parallel      // parallel matrix-matrix multiply
     }
 
     (*AxB_method_used) = AxB_methods_used [0] ;
+    GB_STATS_KERNEL (*AxB_method_used, nthreads, nthreads,
+        (double) total_flops) ;
 
     //--------------------------------------------------------------------------
     // acquire the Saunas for each thread that needs it
@@ -381,16 +404,18 @@ GrB_Info GB_AxB_saxpy_parallel      // parallel matrix-matrix multiply
         reduction(&&:ok)
     for (int tid = 0 ; tid < nthreads ; tid++)
     { 
+        GB_TRACE_BEGIN ("saxpy task") ;
         // each thread allocates its output, using malloc and realloc
         bool thread_mask_applied = false ;
         GrB_Info thread_info = GB_AxB_saxpy_sequential (&(Cslice [tid]), M,
-            Mask_comp, A, (nthreads == 1) ? B : Bslice [tid], semiring,
-            flipxy, AxB_methods_used [tid], bjnz_max [tid],
+            Mask_comp, Mask_struct, A, (nthreads == 1) ? B : Bslice [tid],
+            semiring, flipxy, AxB_methods_used [tid], bjnz_max [tid],
             false, &thread_mask_applied, Sauna_ids [tid]) ;
         // collect all thread-specific info
         ok      = ok      && (thread_info == GrB_SUCCESS) ;
         allmask = allmask && (thread_mask_applied) ;
         panic   = panic   || (thread_info == GrB_PANIC) ;
+        GB_TRACE_END ("saxpy task") ;
     }
 
     //--------------------------------------------------------------------------
@@ -20,6 +20,7 @@ GrB_Info GB_AxB_saxpy_sequential    // single-threaded C<M>=A*B
     GrB_Matrix *Chandle,            // output matrix, NULL on input
     GrB_Matrix M,                   // optional mask matrix
     const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_Matrix A,             // input matrix A
     const GrB_Matrix B,             // input matrix B
     const GrB_Semiring semiring,    // semiring that defines C=A*B
@@ -87,15 +88,15 @@ GrB_Info GB_AxB_saxpy_sequential    // single-threaded C<M>=A*B
     { 
         // C<M> = A*B via heap method
         ASSERT (A->vdim == B->vlen) ;
-        return (GB_AxB_heap (Chandle, M, Mask_comp, A, B, semiring,
-            flipxy, mask_applied, bjnz_max)) ;
+        return (GB_AxB_heap (Chandle, M, Mask_comp, Mask_struct, A, B,
+            semiring, flipxy, mask_applied, bjnz_max)) ;
     }
     else // AxB_method == GxB_AxB_GUSTAVSON
     { 
         // C<M> = A*B via Gustavson method
         ASSERT (A->vdim == B->vlen) ;
-        return (GB_AxB_Gustavson (Chandle, M, Mask_comp, A, B, semiring,
-            flipxy, mask_applied, Sauna_id)) ;
+        return (GB_AxB_Gustavson (Chandle, M, Mask_comp, Mask_struct, A, B,
+            semiring, flipxy, mask_applied, Sauna_id)) ;
     }
 }
 
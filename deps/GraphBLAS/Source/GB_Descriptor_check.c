@@ -38,6 +38,8 @@ static GrB_Info GB_dc
         case GrB_SCMP          : GBPR0 ("scmp      ") ; break ;
         case GrB_TRAN          : GBPR0 ("tran      ") ; break ;
         case GrB_REPLACE       : GBPR0 ("replace   ") ; break ;
+        case GxB_STRUCTURE     : GBPR0 ("structure ") ; break ;
+        case GxB_STRUCT_COMP   : GBPR0 ("struct_comp") ; break ;
         case GxB_AxB_GUSTAVSON : GBPR0 ("Gustavson ") ; break ;
         case GxB_AxB_HEAP      : GBPR0 ("heap      ") ; break ;
         case GxB_AxB_DOT       : GBPR0 ("dot       ") ; break ;
@@ -52,8 +54,11 @@ static GrB_Info GB_dc
         if (spec)
         {
             // descriptor field can be set to the default,
-            // or one non-default value
-            if (! (v == GxB_DEFAULT || v == nondefault))
+            // or one non-default value, except that the mask can also be
+            // structural
+            bool mask_struct = (nondefault == GrB_SCMP) &&
+                (v == GxB_STRUCTURE || v == GxB_STRUCT_COMP) ;
+            if (! (v == GxB_DEFAULT || v == nondefault || mask_struct))
             { 
                 ok = false ;
             }
@@ -20,7 +20,8 @@
 //      descriptor does not affect how C is used to compute the results.  If
 //      GxB_DEFAULT, then C is not cleared before doing C<M>=results.
 
-//  desc->mask                  GxB_DEFAULT or GrB_SCMP
+//  desc->mask                  GxB_DEFAULT, GrB_SCMP, GxB_STRUCTURE, or
+//                              GxB_STRUCT_COMP
 
 //      An optional 'write mask' defines how the results are to be written back
 //      into C.  The boolean mask matrix M has the same size as C (M is
@@ -43,6 +44,11 @@
 //      (i,j) is not present and thus implicitly zero.  Both mean 'M(i,j)=0'
 //      in the description above of how the mask M works.
 
+//      If desc->mask is GxB_STRUCTURE or GxB_STRUCT_COMP, then only the
+//      pattern of M is used.  M(i,j) is 1 if the entry is present in the
+//      data structure of M, and 0 otherwise, and the values of M are never
+//      read.  GxB_STRUCT_COMP complements the structural mask, like GrB_SCMP.
+
 //  desc->in0 and desc->in1     GxB_DEFAULT or GrB_TRAN
 
 //      A GrB_Matrix passed as an input parameter to GraphBLAS methods can
@@ -75,6 +81,7 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
     const GrB_Descriptor desc,  // descriptor to query, may be NULL
     bool *C_replace,            // if true replace C before C<M>=Z
     bool *Mask_comp,            // if true use logical negation of M
+    bool *Mask_struct,          // if true use only the pattern of M
     bool *In0_transpose,        // if true transpose first input
     bool *In1_transpose,        // if true transpose second input
     GrB_Desc_Value *AxB_method, // method for C=A*B
@@ -108,7 +115,7 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
     { 
         // get the contents
         C_desc    = desc->out ;   // DEFAULT or REPLACE
-        Mask_desc = desc->mask ;  // DEFAULT or SCMP
+        Mask_desc = desc->mask ;  // DEFAULT, SCMP, STRUCTURE, or STRUCT_COMP
         In0_desc  = desc->in0 ;   // DEFAULT or TRAN
         In1_desc  = desc->in1 ;   // DEFAULT or TRAN
         AxB_desc  = desc->axb ;   // DEFAULT, GUSTAVSON, HEAP, or DOT
@@ -123,7 +130,8 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
 
     // check for valid values of each descriptor field
     if (!(C_desc    == GxB_DEFAULT || C_desc    == GrB_REPLACE) ||
-        !(Mask_desc == GxB_DEFAULT || Mask_desc == GrB_SCMP) ||
+        !(Mask_desc == GxB_DEFAULT   || Mask_desc == GrB_SCMP ||
+          Mask_desc == GxB_STRUCTURE || Mask_desc == GxB_STRUCT_COMP) ||
         !(In0_desc  == GxB_DEFAULT || In0_desc  == GrB_TRAN) ||
         !(In1_desc  == GxB_DEFAULT || In1_desc  == GrB_TRAN) ||
         !(AxB_desc  == GxB_DEFAULT || AxB_desc  == GxB_AxB_GUSTAVSON ||
@@ -138,7 +146,12 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
     }
     if (Mask_comp != NULL)
     { 
-        *Mask_comp = (Mask_desc == GrB_SCMP) ;
+        *Mask_comp = (Mask_desc == GrB_SCMP || Mask_desc == GxB_STRUCT_COMP) ;
+    }
+    if (Mask_struct != NULL)
+    { 
+        *Mask_struct = (Mask_desc == GxB_STRUCTURE ||
+                        Mask_desc == GxB_STRUCT_COMP) ;
     }
     if (In0_transpose != NULL)
     { 
@@ -16,6 +16,7 @@
 // settings.
 
 #include "GB.h"
+#include <stdatomic.h>
 
 //------------------------------------------------------------------------------
 // Global storage: for all threads in a user application that uses GraphBLAS
@@ -34,24 +35,33 @@ typedef struct
     // GrB_setElement, GxB_subassign, and GrB_assign that haven't been added to
     // the matrix yet.
 
-    // A matrix with no pending tuples is not in the list.  When a matrix gets
-    // its first pending tuple, it is added to the list.  A matrix is removed
-    // from the list when another operation needs to use the matrix; in that
-    // case the pending tuples are assembled for just that one matrix.  The
-    // GrB_wait operation iterates through the entire list and assembles all
-    // the pending tuples for all the matrices in the list, leaving the list
-    // emtpy.  A simple link list suffices for the list.  The links are in the
-    // matrices themselves so no additional memory needs to be allocated.  The
-    // list never needs to be searched; if a particular matrix is to be removed
-    // from the list, the GraphBLAS operation already been given the matrix
-    // handle, and the prev & next pointers it contains.  All of these
-    // operations can thus be done in O(1) time, except for GrB_wait which
-    // needs to traverse the whole list once and then the list is empty
-    // afterwards.
-
-    // The access of these variables must be protected in a critical section.
-
-    void *queue_head ;          // head pointer to matrix queue
+    // When a matrix gets its first pending tuple or zombie, it is added to
+    // the list.  When another operation needs to use the matrix, the pending
+    // tuples are assembled for just that one matrix, but the matrix is left
+    // in the list, so that a matrix that repeatedly gains and finishes
+    // pending work (with GrB_setElement, for example) does not enter and
+    // leave the list each time.  A matrix is removed from the list only when
+    // its content is freed, or by GrB_wait.  The GrB_wait operation iterates
+    // through the entire list and assembles all the pending tuples for all
+    // the matrices in the list, leaving the list emtpy.  A simple link list
+    // suffices for the list.  The links are in the matrices themselves so no
+    // additional memory needs to be allocated.  The list never needs to be
+    // searched; if a particular matrix is to be removed from the list, the
+    // GraphBLAS operation already been given the matrix handle, and the prev
+    // & next pointers it contains.  All of these operations can thus be done
+    // in O(1) time, except for GrB_wait which needs to traverse the whole list
+    // once and then the list is empty afterwards.
+
+    // The list is split into GB_QUEUE_NSHARDS independent lists (shards),
+    // and each matrix always lives in the shard given by GB_QUEUE_SHARD.
+    // Each shard is protected by its own spin lock, so that user threads
+    // working on different matrices rarely contend for the same lock.  The
+    // spin locks are C11 atomic flags, which work with any user threading
+    // model.  The work done while holding a lock is just a few pointer
+    // updates.
+
+    void *queue_head [GB_QUEUE_NSHARDS] ;       // head of each shard
+    atomic_flag queue_lock [GB_QUEUE_NSHARDS] ; // spin lock for each shard
 
     GrB_Mode mode ;             // GrB_NONBLOCKING or GrB_BLOCKING
 
@@ -92,6 +102,50 @@ typedef struct
     void * (* realloc_function ) (void *, size_t) ;
     void   (* free_function    ) (void *)         ;
     bool malloc_is_thread_safe ;   // default is true
+    bool arena ;                // if true, use the workspace arena (GB_arena.c)
+    GxB_NUMA_Policy numa ;      // NUMA placement of matrix content
+
+    //--------------------------------------------------------------------------
+    // transparent huge pages (see GB_hugepage.c)
+    //--------------------------------------------------------------------------
+
+    // hugepage_threshold: blocks of at least this many bytes are allocated on
+    // huge pages; zero if disabled.  hugepage_inuse: the # of bytes currently
+    // allocated on huge pages, by all threads.  Unlike the memory usage
+    // statistics below, this is always computed.
+
+    size_t hugepage_threshold ;
+    int64_t hugepage_inuse ;
+
+    //--------------------------------------------------------------------------
+    // memory usage
+    //--------------------------------------------------------------------------
+
+    // memory_inuse: the # of bytes allocated by GB_malloc_memory,
+    // GB_calloc_memory and GB_realloc_memory and not yet freed, by all
+    // threads.  memory_peak: the max value of memory_inuse since GrB_init or
+    // the last reset.  Unlike inuse and maxused below, these are always
+    // computed.  Each thread collects its changes in a thread-local counter,
+    // and adds them to memory_inuse once they reach GB_MEMORY_FLUSH bytes,
+    // so the values can lag by up to that many bytes per thread.  Blocks of
+    // workspace in the arena (see GB_arena.c) are not counted.
+
+    int64_t memory_inuse ;
+    int64_t memory_peak ;
+
+    //--------------------------------------------------------------------------
+    // per-operation telemetry (see GB_stats.c)
+    //--------------------------------------------------------------------------
+
+    // stats: true if GxB_STATS is enabled.  stats_bytes: the # of bytes
+    // allocated by all threads while stats is enabled.  stats_log: a ring
+    // buffer with the most recent records.  stats_count: the # of records
+    // appended since the log was last cleared.
+
+    bool stats ;
+    int64_t stats_bytes ;
+    int64_t stats_count ;
+    GxB_Stats stats_log [GxB_STATS_LOG_SIZE] ;
 
     //--------------------------------------------------------------------------
     // memory usage tracking: for testing and debugging only
@@ -139,7 +193,8 @@ GB_Global_struct GB_Global =
 {
 
     // queued matrices with work to do
-    .queue_head = NULL,         // pointer to first queued matrix
+    .queue_head = { NULL },     // pointer to first queued matrix
+    .queue_lock = { ATOMIC_FLAG_INIT },     // all locks are clear
 
     // GraphBLAS mode
     .mode = GrB_NONBLOCKING,    // default is nonblocking
@@ -168,6 +223,21 @@ GB_Global_struct GB_Global =
     .realloc_function = realloc,
     .free_function    = free,
     .malloc_is_thread_safe = true,
+    .arena = false,             // workspace arena is disabled by default
+    .numa = GxB_NUMA_NONE,      // matrix content is placed by the OS
+
+    // transparent huge pages
+    .hugepage_threshold = 0,    // huge pages are disabled by default
+    .hugepage_inuse = 0,
+
+    // memory usage
+    .memory_inuse = 0,
+    .memory_peak = 0,
+
+    // per-operation telemetry
+    .stats = false,             // telemetry is disabled by default
+    .stats_bytes = 0,
+    .stats_count = 0,
 
     // malloc tracking, for testing, statistics, and debugging only
     .malloc_tracking = false,
@@ -186,17 +256,32 @@ GB_Global_struct GB_Global =
 //==============================================================================
 
 //------------------------------------------------------------------------------
-// queue_head
+// queue_head and queue_lock
 //------------------------------------------------------------------------------
 
-void GB_Global_queue_head_set (void *p)
+void GB_Global_queue_head_set (int shard, void *p)
 { 
-    GB_Global.queue_head = p ;
+    GB_Global.queue_head [shard] = p ;
 }
 
-void *GB_Global_queue_head_get (void)
+void *GB_Global_queue_head_get (int shard)
 { 
-    return (GB_Global.queue_head) ;
+    return (GB_Global.queue_head [shard]) ;
+}
+
+void GB_Global_queue_lock (int shard)
+{
+    while (atomic_flag_test_and_set_explicit (&(GB_Global.queue_lock [shard]),
+        memory_order_acquire))
+    { 
+        // spin; the lock is held only for a few pointer updates
+    }
+}
+
+void GB_Global_queue_unlock (int shard)
+{ 
+    atomic_flag_clear_explicit (&(GB_Global.queue_lock [shard]),
+        memory_order_release) ;
 }
 
 //------------------------------------------------------------------------------
@@ -469,6 +554,205 @@ bool GB_Global_malloc_is_thread_safe_get (void)
     return (GB_Global.malloc_is_thread_safe) ;
 }
 
+//------------------------------------------------------------------------------
+// arena
+//------------------------------------------------------------------------------
+
+void GB_Global_arena_set (bool arena)
+{ 
+    GB_Global.arena = arena ;
+}
+
+bool GB_Global_arena_get (void)
+{ 
+    return (GB_Global.arena) ;
+}
+
+//------------------------------------------------------------------------------
+// numa
+//------------------------------------------------------------------------------
+
+void GB_Global_numa_set (GxB_NUMA_Policy numa)
+{ 
+    GB_Global.numa = numa ;
+}
+
+GxB_NUMA_Policy GB_Global_numa_get (void)
+{ 
+    return (GB_Global.numa) ;
+}
+
+//------------------------------------------------------------------------------
+// hugepage_threshold and hugepage_inuse
+//------------------------------------------------------------------------------
+
+void GB_Global_hugepage_threshold_set (size_t threshold)
+{ 
+    GB_Global.hugepage_threshold = threshold ;
+}
+
+size_t GB_Global_hugepage_threshold_get (void)
+{ 
+    // huge pages are allocated with posix_memalign and freed with free, so
+    // they cannot be used with user-defined memory management functions
+    bool ansi = (GB_Global.malloc_function == malloc &&
+                 GB_Global.calloc_function == calloc &&
+                 GB_Global.realloc_function == realloc &&
+                 GB_Global.free_function == free) ;
+    return (ansi ? GB_Global.hugepage_threshold : 0) ;
+}
+
+void GB_Global_hugepage_inuse_increment (int64_t s)
+{ 
+    #pragma omp atomic
+    GB_Global.hugepage_inuse += s ;
+}
+
+void GB_Global_hugepage_inuse_decrement (int64_t s)
+{ 
+    #pragma omp atomic
+    GB_Global.hugepage_inuse -= s ;
+}
+
+int64_t GB_Global_hugepage_inuse_get (void)
+{ 
+    int64_t s ;
+    #pragma omp atomic read
+    s = GB_Global.hugepage_inuse ;
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// memory_inuse and memory_peak
+//------------------------------------------------------------------------------
+
+// changes of less than this many bytes are kept in the thread-local counter
+#define GB_MEMORY_FLUSH (64 * 1024)
+
+// bytes allocated (or freed, if negative) by this thread and not yet added to
+// GB_Global.memory_inuse
+static _Thread_local int64_t GB_memory_delta = 0 ;
+
+// raise memory_peak to at least inuse
+static void GB_Global_memory_peak_update (int64_t inuse)
+{
+    int64_t peak ;
+    #pragma omp atomic read
+    peak = GB_Global.memory_peak ;
+    if (inuse > peak)
+    {
+        #pragma omp critical (GB_memory_peak)
+        { 
+            if (inuse > GB_Global.memory_peak)
+            { 
+                GB_Global.memory_peak = inuse ;
+            }
+        }
+    }
+}
+
+void GB_Global_memory_update (int64_t s)
+{
+    int64_t delta = GB_memory_delta + s ;
+    if (delta > -GB_MEMORY_FLUSH && delta < GB_MEMORY_FLUSH)
+    { 
+        // small change: keep it in this thread
+        GB_memory_delta = delta ;
+        return ;
+    }
+    GB_memory_delta = 0 ;
+    int64_t inuse ;
+    #pragma omp atomic capture
+    inuse = GB_Global.memory_inuse += delta ;
+    GB_Global_memory_peak_update (inuse) ;
+}
+
+int64_t GB_Global_memory_inuse_get (void)
+{ 
+    // include the changes of this thread not yet added
+    int64_t inuse ;
+    #pragma omp atomic read
+    inuse = GB_Global.memory_inuse ;
+    return (inuse + GB_memory_delta) ;
+}
+
+int64_t GB_Global_memory_peak_get (void)
+{ 
+    GB_Global_memory_peak_update (GB_Global_memory_inuse_get ( )) ;
+    int64_t peak ;
+    #pragma omp atomic read
+    peak = GB_Global.memory_peak ;
+    return (peak) ;
+}
+
+void GB_Global_memory_peak_reset (void)
+{ 
+    int64_t inuse = GB_Global_memory_inuse_get ( ) ;
+    #pragma omp critical (GB_memory_peak)
+    { 
+        GB_Global.memory_peak = inuse ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// stats: per-operation telemetry
+//------------------------------------------------------------------------------
+
+void GB_Global_stats_set (bool stats)
+{ 
+    GB_Global.stats = stats ;
+}
+
+bool GB_Global_stats_get (void)
+{ 
+    return (GB_Global.stats) ;
+}
+
+void GB_Global_stats_bytes_increment (int64_t s)
+{ 
+    #pragma omp atomic
+    GB_Global.stats_bytes += s ;
+}
+
+int64_t GB_Global_stats_bytes_get (void)
+{ 
+    int64_t s ;
+    #pragma omp atomic read
+    s = GB_Global.stats_bytes ;
+    return (s) ;
+}
+
+void GB_Global_stats_log_append (const GxB_Stats *record)
+{ 
+    // claim a slot; user threads may append concurrently
+    int64_t k ;
+    #pragma omp atomic capture
+    k = GB_Global.stats_count++ ;
+    GB_Global.stats_log [k % GxB_STATS_LOG_SIZE] = (*record) ;
+}
+
+int64_t GB_Global_stats_log_get     // return # of records copied
+(
+    GxB_Stats *records,             // array of size nmax
+    int64_t nmax
+)
+{
+    // copy the most recent records, oldest first
+    int64_t count = GB_Global.stats_count ;
+    int64_t n = GB_IMIN (nmax, GB_IMIN (count, GxB_STATS_LOG_SIZE)) ;
+    for (int64_t k = 0 ; k < n ; k++)
+    { 
+        int64_t slot = (count - n + k) % GxB_STATS_LOG_SIZE ;
+        records [k] = GB_Global.stats_log [slot] ;
+    }
+    return (n) ;
+}
+
+void GB_Global_stats_log_clear (void)
+{ 
+    GB_Global.stats_count = 0 ;
+}
+
 //------------------------------------------------------------------------------
 // malloc_tracking
 //------------------------------------------------------------------------------
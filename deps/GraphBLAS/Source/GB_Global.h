@@ -14,8 +14,10 @@
 #ifndef GB_GLOBAL_H
 #define GB_GLOBAL_H
 
-void     GB_Global_queue_head_set (void *p) ;
-void  *  GB_Global_queue_head_get (void) ;
+void     GB_Global_queue_head_set (int shard, void *p) ;
+void  *  GB_Global_queue_head_get (int shard) ;
+void     GB_Global_queue_lock (int shard) ;
+void     GB_Global_queue_unlock (int shard) ;
 
 void     GB_Global_mode_set (GrB_Mode mode) ;
 GrB_Mode GB_Global_mode_get (void) ;
@@ -73,6 +75,32 @@ void     GB_Global_malloc_is_thread_safe_set
          ) ;
 bool     GB_Global_malloc_is_thread_safe_get (void) ;
 
+void     GB_Global_arena_set (bool arena) ;
+bool     GB_Global_arena_get (void) ;
+
+void     GB_Global_numa_set (GxB_NUMA_Policy numa) ;
+GxB_NUMA_Policy GB_Global_numa_get (void) ;
+
+void     GB_Global_hugepage_threshold_set (size_t threshold) ;
+size_t   GB_Global_hugepage_threshold_get (void) ;
+
+void     GB_Global_hugepage_inuse_increment (int64_t s) ;
+void     GB_Global_hugepage_inuse_decrement (int64_t s) ;
+int64_t  GB_Global_hugepage_inuse_get (void) ;
+
+void     GB_Global_memory_update (int64_t s) ;
+int64_t  GB_Global_memory_inuse_get (void) ;
+int64_t  GB_Global_memory_peak_get (void) ;
+void     GB_Global_memory_peak_reset (void) ;
+
+void     GB_Global_stats_set (bool stats) ;
+bool     GB_Global_stats_get (void) ;
+void     GB_Global_stats_bytes_increment (int64_t s) ;
+int64_t  GB_Global_stats_bytes_get (void) ;
+void     GB_Global_stats_log_append (const GxB_Stats *record) ;
+int64_t  GB_Global_stats_log_get (GxB_Stats *records, int64_t nmax) ;
+void     GB_Global_stats_log_clear (void) ;
+
 void     GB_Global_malloc_tracking_set (bool malloc_tracking) ;
 bool     GB_Global_malloc_tracking_get (void) ;
 
@@ -48,6 +48,10 @@
 
 // desc [GB_MASK] = GrB_SCMP means to use the logical negation of M
 
+// desc [GB_MASK] = GxB_STRUCTURE means to use only the pattern of M, so that
+// M(i,j) is true if it is present, even if its value is zero.
+// GxB_STRUCT_COMP is the negation of the structural mask.
+
 // desc [GB_OUTP] = GxB_DEFAULT means to use C as-is.
 
 // desc [GB_OUTP] = GrB_REPLACE means to clear C before writing Z into C.
@@ -57,6 +61,7 @@
 #include "GB_mask.h"
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
+#include "GB_apply.h"
 
 /* -----------------------------------------------------------------------------
 
@@ -122,6 +127,7 @@
 {                                   \
     GB_MATRIX_FREE (Thandle) ;      \
     GB_MATRIX_FREE (&MT) ;          \
+    GB_MATRIX_FREE (&MS) ;          \
     GB_MATRIX_FREE (&Z) ;           \
 }
 
@@ -138,6 +144,7 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
     GrB_Matrix *Thandle,        // results of computation, freed when done
     const bool C_replace,       // if true, clear C first
     const bool Mask_comp,       // if true, complement the mask
+    const bool Mask_struct,     // if true, use only the pattern of the mask
     GB_Context Context
 )
 {
@@ -152,6 +159,7 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
     GrB_Info info ;
     GrB_Matrix T = *Thandle ;
     GrB_Matrix MT = NULL ;
+    GrB_Matrix MS = NULL ;
     GrB_Matrix M = M_in ;
     GrB_Matrix Z = NULL ;
 
@@ -183,6 +191,23 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
         GB_OK (GB_wait (T, Context)) ;
     }
 
+    //--------------------------------------------------------------------------
+    // copy any views into standard matrices
+    //--------------------------------------------------------------------------
+
+    // A view (see GxB_Matrix_tri_view) cannot be used as a mask below, nor
+    // modified in place.  The content of C is only needed if M or accum are
+    // present; otherwise C is simply replaced with T.
+
+    if (GB_IS_VIEW (M))
+    { 
+        GB_OK (GB_wait (M, Context)) ;
+    }
+    if (GB_IS_VIEW (C) && (M != NULL || accum != NULL))
+    { 
+        GB_OK (GB_wait (C, Context)) ;
+    }
+
     //--------------------------------------------------------------------------
     // ensure M and T have the same CSR/CSC format as C
     //--------------------------------------------------------------------------
@@ -262,6 +287,14 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
         // C(:,:)<M> = accum (C(:,:),T) via GB_subassigner
         //----------------------------------------------------------------------
 
+        // GB_subassigner reads the values of the mask, so a structural mask
+        // is replaced with a boolean shallow copy of M, with all values true
+        if (Mask_struct && M != NULL)
+        { 
+            GB_OK (GB_shallow_op (&MS, M->is_csc, GxB_ONE_BOOL, M, Context)) ;
+            M = MS ;
+        }
+
         GB_OK (GB_subassigner (C, C_replace, M, Mask_comp, accum,
             T, GrB_ALL, 0, GrB_ALL, 0, false, NULL, GB_ignore_code, Context)) ;
 
@@ -318,7 +351,8 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
                 M1 = M ;
             }
 
-            GB_OK (GB_add (&Z, C->type, C->is_csc, M1, C, T, accum, Context)) ;
+            GB_OK (GB_add (&Z, C->type, C->is_csc, M1, Mask_struct, C, T,
+                accum, Context)) ;
             GB_MATRIX_FREE (Thandle) ;
         }
 
@@ -339,7 +373,8 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
 
         // apply the mask, storing the results back into C, and free Z.
         ASSERT_OK (GB_check (C, "C<M>=Z input", GB0)) ;
-        GB_OK (GB_mask (C, M, &Z, C_replace, Mask_comp, Context)) ;
+        GB_OK (GB_mask (C, M, &Z, C_replace, Mask_comp, Mask_struct,
+            Context)) ;
         ASSERT (Z == NULL) ;
         ASSERT (!C->p_shallow && !C->h_shallow) ;
         ASSERT (!C->i_shallow && !C->x_shallow) ;
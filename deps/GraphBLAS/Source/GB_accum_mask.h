@@ -39,10 +39,12 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
     GrB_Matrix *Thandle,        // results of computation, freed when done
     const bool C_replace,       // if true, clear C first
     const bool Mask_comp,       // if true, complement the mask
+    const bool Mask_struct,     // if true, use only the pattern of the mask
     GB_Context Context
 ) ;
 
-#define GB_ACCUM_MASK(C, M, MT, accum, Thandle, C_replace, Mask_comp) \
-        GB_accum_mask(C, M, MT, accum, Thandle, C_replace, Mask_comp, Context)
+#define GB_ACCUM_MASK(C,M,MT,accum,Thandle,C_replace,Mask_comp,Mask_struct)  \
+        GB_accum_mask(C, M, MT, accum, Thandle, C_replace, Mask_comp,        \
+            Mask_struct, Context)
 #endif
 
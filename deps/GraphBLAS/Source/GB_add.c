@@ -30,6 +30,8 @@
 
 // op may be NULL.  In this case, the intersection of A and B must be empty.
 // This is used by GB_wait only, for merging the pending tuple matrix T into A.
+// In this case, A may have zombies (but no pending tuples).  The zombies are
+// not copied into C, so they are deleted in the same pass that adds T to A.
 // Any duplicate pending tuples have already been summed in T, so the
 // intersection of T and A is always empty.
 
@@ -41,6 +43,7 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
     const GrB_Type ctype,   // type of output matrix C
     const bool C_is_csc,    // format of output matrix C
     const GrB_Matrix M,     // optional mask for C, unused if NULL
+    const bool Mask_struct, // if true, use only the pattern of M
     const GrB_Matrix A,     // input A matrix
     const GrB_Matrix B,     // input B matrix
     const GrB_BinaryOp op,  // op to perform C = op (A,B)
@@ -53,7 +56,8 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
     //--------------------------------------------------------------------------
 
     ASSERT (Chandle != NULL) ;
-    ASSERT_OK (GB_check (A, "A for add", GB0)) ;
+    // A can have zombies if op is NULL, and it may not be in the queue
+    ASSERT_OK (GB_check (A, "A for add", (op == NULL) ? GB_FLIP (GB0) : GB0)) ;
     ASSERT_OK (GB_check (B, "B for add", GB0)) ;
     ASSERT_OK_OR_NULL (GB_check (op, "op for add", GB0)) ;
     ASSERT_OK_OR_NULL (GB_check (M, "M for add", GB0)) ;
@@ -63,13 +67,20 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
         ASSERT (A->vdim == M->vdim && A->vlen == M->vlen) ;
     }
 
-    // delete any lingering zombies and assemble any pending tuples
+    // delete any lingering zombies and assemble any pending tuples, except
+    // for GB_wait (op is NULL), which passes in A with its zombies intact
     GB_WAIT (M) ;
-    GB_WAIT (A) ;
+    if (op == NULL)
+    { 
+        ASSERT (!GB_PENDING (A)) ;
+        ASSERT (M == NULL) ;
+    }
+    else
+    { 
+        GB_WAIT (A) ;
+    }
     GB_WAIT (B) ;
 
-    // FUTURE:: tolerate zombies in A (at least) for GB_wait.
-
     //--------------------------------------------------------------------------
     // initializations
     //--------------------------------------------------------------------------
@@ -132,7 +143,7 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
         // from phase0:
         Cnvec, Ch, C_to_M, C_to_A, C_to_B, Ch_is_Mh,
         // original input:
-        M, A, B, Context) ;
+        M, Mask_struct, A, B, Context) ;
 
     if (info != GrB_SUCCESS)
     { 
@@ -162,7 +173,7 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
         // from phase0:
         Cnvec, Ch, C_to_M, C_to_A, C_to_B, Ch_is_Mh,
         // original input:
-        M, A, B, Context) ;
+        M, Mask_struct, A, B, Context) ;
 
     // free workspace
     GB_FREE_MEMORY (TaskList, max_ntasks+1, sizeof (GB_task_struct)) ;
@@ -17,6 +17,7 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
     const GrB_Type ctype,   // type of output matrix C
     const bool C_is_csc,    // format of output matrix C
     const GrB_Matrix M,     // optional mask for C, unused if NULL
+    const bool Mask_struct, // if true, use only the pattern of M
     const GrB_Matrix A,     // input A matrix
     const GrB_Matrix B,     // input B matrix
     const GrB_BinaryOp op,  // op to perform C = op (A,B)
@@ -55,6 +56,7 @@ GrB_Info GB_add_phase1                  // count nnz in each C(:,j)
     const bool Ch_is_Mh,                // if true, then Ch == M->h
     // original input:
     const GrB_Matrix M,                 // optional mask, may be NULL
+    const bool Mask_struct,             // if true, use only the pattern of M
     const GrB_Matrix A,
     const GrB_Matrix B,
     GB_Context Context
@@ -82,6 +84,7 @@ GrB_Info GB_add_phase2      // C=A+B or C<M>=A+B
     const bool Ch_is_Mh,        // if true, then Ch == M->h
     // original input:
     const GrB_Matrix M,         // optional mask, may be NULL
+    const bool Mask_struct,     // if true, use only the pattern of M
     const GrB_Matrix A,
     const GrB_Matrix B,
     GB_Context Context
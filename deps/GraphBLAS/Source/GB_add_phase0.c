@@ -143,7 +143,8 @@ GrB_Info GB_add_phase0          // find vectors in C for C=A+B or C<M>=A+B
     ASSERT (Ch_handle != NULL) ;
     ASSERT (C_to_A_handle != NULL) ;
     ASSERT (C_to_B_handle != NULL) ;
-    ASSERT_OK (GB_check (A, "A for add phase0", GB0)) ;
+    ASSERT_OK (GB_check (A, "A for add phase0",
+        GB_ZOMBIES (A) ? GB_FLIP (GB0) : GB0)) ;
     ASSERT_OK (GB_check (B, "B for add phase0", GB0)) ;
     ASSERT_OK_OR_NULL (GB_check (M, "M for add phase0", GB0)) ;
     ASSERT (A->vdim == B->vdim) ;
@@ -301,7 +302,7 @@ GrB_Info GB_add_phase0          // find vectors in C for C=A+B or C<M>=A+B
             GB_slice_vector (NULL, NULL,
                 &(kA_start [taskid]), &(kB_start [taskid]),
                 0, 0, NULL,                 // Mi not present
-                0, Anvec, Ah, A_hfirst,     // Ah, explicit or implicit list
+                0, Anvec, Ah, A_hfirst, 0,  // Ah, explicit or implicit list
                 0, Bnvec, Bh,               // Bh, explicit list
                 n,                          // Ah and Bh have dimension n
                 target_work) ;
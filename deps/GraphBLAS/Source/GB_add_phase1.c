@@ -17,7 +17,8 @@
 
 // GB_wait computes A=A+T where T is the matrix of the assembled pending
 // tuples.  A and T are disjoint, so this function does not need to examine
-// the pattern of A and T at all.  No mask is used in this case.
+// the pattern of A and T at all, unless A has zombies, which are not counted.
+// No mask is used in this case.
 
 // Cp is either freed by phase2, or transplanted into C.
 
@@ -41,6 +42,7 @@ GrB_Info GB_add_phase1                  // count nnz in each C(:,j)
     const bool Ch_is_Mh,                // if true, then Ch == M->h
     // original input:
     const GrB_Matrix M,                 // optional mask, may be NULL
+    const bool Mask_struct,             // if true, use only the pattern of M
     const GrB_Matrix A,
     const GrB_Matrix B,
     GB_Context Context
@@ -53,7 +55,8 @@ GrB_Info GB_add_phase1                  // count nnz in each C(:,j)
 
     ASSERT (Cp_handle != NULL) ;
     ASSERT (Cnvec_nonempty != NULL) ;
-    ASSERT_OK (GB_check (A, "A for add phase1", GB0)) ;
+    ASSERT_OK (GB_check (A, "A for add phase1",
+        A_and_B_are_disjoint ? GB_FLIP (GB0) : GB0)) ;
     ASSERT_OK (GB_check (B, "B for add phase1", GB0)) ;
     ASSERT_OK_OR_NULL (GB_check (M, "M for add phase1", GB0)) ;
     ASSERT (A->vdim == B->vdim) ;
@@ -52,6 +52,7 @@ GrB_Info GB_add_phase2      // C=A+B or C<M>=A+B
     const bool Ch_is_Mh,        // if true, then Ch == M->h
     // original input:
     const GrB_Matrix M,         // optional mask, may be NULL
+    const bool Mask_struct,     // if true, use only the pattern of M
     const GrB_Matrix A,
     const GrB_Matrix B,
     GB_Context Context
@@ -64,7 +65,8 @@ GrB_Info GB_add_phase2      // C=A+B or C<M>=A+B
 
     ASSERT (Cp != NULL) ;
     ASSERT_OK_OR_NULL (GB_check (op, "op for add phase2", GB0)) ;
-    ASSERT_OK (GB_check (A, "A for add phase2", GB0)) ;
+    ASSERT_OK (GB_check (A, "A for add phase2",
+        (op == NULL) ? GB_FLIP (GB0) : GB0)) ;
     ASSERT_OK (GB_check (B, "B for add phase2", GB0)) ;
     ASSERT_OK_OR_NULL (GB_check (M, "M for add phase2", GB0)) ;
     ASSERT (A->vdim == B->vdim) ;
@@ -146,7 +148,7 @@ GrB_Info GB_add_phase2      // C=A+B or C<M>=A+B
 
     #define GB_BINOP_WORKER(mult,xyname)                            \
     {                                                               \
-        info = GB_AaddB(mult,xyname) (C, M, A, B, Ch_is_Mh,         \
+        info = GB_AaddB(mult,xyname) (C, M, Mask_struct, A, B, Ch_is_Mh, \
             C_to_M, C_to_A, C_to_B, TaskList, ntasks, nthreads) ;   \
         done = (info != GrB_NO_VALUE) ;                             \
     }                                                               \
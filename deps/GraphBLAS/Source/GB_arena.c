@@ -0,0 +1,290 @@
+//------------------------------------------------------------------------------
+// GB_arena: thread-local bump allocator for operation-scoped workspace
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Short-lived workspace (task lists, cumulative work arrays, and the like) is
+// allocated and freed by every call to GraphBLAS.  If enabled by
+// GxB_set (GxB_ARENA, true), this workspace is taken from a single block of
+// memory owned by the calling thread instead of from malloc_function.  Each
+// allocation just bumps a pointer into the block.  Each free decrements a
+// count of live blocks, and when the count drops to zero (which is the case
+// when the GraphBLAS operation that allocated them returns) the whole arena is
+// reset, for reuse by the next operation.
+
+// If a request does not fit in the arena, it is allocated with
+// GB_malloc_memory instead, and the arena is grown (at least doubling in size)
+// the next time it is reset, so that after a few operations all of their
+// workspace fits.  The arena is never grown beyond GB_ARENA_MAX bytes.
+
+// Only workspace that is freed before the operation returns, by the same user
+// thread that allocated it, may be allocated from the arena.  The content of
+// matrices must always be allocated by GB_malloc_memory or GB_calloc_memory.
+// Workspace from the arena is freed by GB_FREE_MEMORY, as usual.
+
+// The arena of each thread is not included in the memory usage statistics
+// (GB_Global_nmalloc_get and GB_Global_inuse_get), since it is not part of
+// any GraphBLAS object.  It is freed by GrB_finalize, for the calling thread.
+// The arenas of the other user threads that call GraphBLAS (a worker pthread
+// of the application, for example) are freed when each thread exits, by the
+// destructor of a pthread key, if POSIX threads are available.
+
+#include "GB.h"
+
+#if defined ( HAVE_PTHREADS )
+#include <pthread.h>
+#endif
+
+typedef struct
+{
+    void *base ;            // block allocated by malloc_function
+    uint8_t *block ;        // base, aligned to GB_ARENA_ALIGN bytes
+    size_t size ;           // size of block, in bytes
+    size_t used ;           // block [0..used-1] is in use
+    size_t spill ;          // bytes not in the arena since the last reset
+    size_t want ;           // size needed to hold all workspace since reset
+    int64_t live ;          // # of blocks allocated from the arena and in use
+}
+GB_arena_struct ;
+
+static _Thread_local GB_arena_struct GB_arena =
+{
+    .base = NULL, .block = NULL, .size = 0, .used = 0, .spill = 0, .want = 0,
+    .live = 0
+} ;
+
+//------------------------------------------------------------------------------
+// GB_arena_exit: free the arena of a thread when it exits
+//------------------------------------------------------------------------------
+
+#if defined ( HAVE_PTHREADS )
+
+static pthread_once_t GB_arena_once = PTHREAD_ONCE_INIT ;
+static pthread_key_t GB_arena_key ;
+static bool GB_arena_key_ok = false ;
+
+// called by pthreads when a thread with an arena exits; the thread-local
+// storage of the exiting thread is still valid
+static void GB_arena_exit (void *arena)
+{
+    GB_arena_struct *a = (GB_arena_struct *) arena ;
+    if (a->base != NULL)
+    { 
+        GB_Global_free_function (a->base) ;
+        a->base = NULL ;
+        a->block = NULL ;
+        a->size = 0 ;
+    }
+}
+
+static void GB_arena_key_create (void)
+{ 
+    GB_arena_key_ok =
+        (pthread_key_create (&GB_arena_key, GB_arena_exit) == 0) ;
+}
+
+#endif
+
+// free the arena of this thread when it exits, once it has a block
+static void GB_arena_register (void)
+{
+    #if defined ( HAVE_PTHREADS )
+    pthread_once (&GB_arena_once, GB_arena_key_create) ;
+    if (GB_arena_key_ok)
+    { 
+        pthread_setspecific (GB_arena_key, &GB_arena) ;
+    }
+    #endif
+}
+
+// true if p was allocated from the arena of this thread
+#define GB_ARENA_OWNS(p) \
+    (GB_arena.block != NULL && (uint8_t *) (p) >= GB_arena.block && \
+    (uint8_t *) (p) < GB_arena.block + GB_arena.size)
+
+//------------------------------------------------------------------------------
+// GB_arena_reset: reset the arena when no blocks are in use
+//------------------------------------------------------------------------------
+
+static void GB_arena_reset (void)
+{
+    ASSERT (GB_arena.live == 0) ;
+    GB_arena.used = 0 ;
+
+    if (GB_arena.want > GB_arena.size && GB_arena.size < GB_ARENA_MAX)
+    {
+        // grow the arena so it can hold all the workspace of the last
+        // operation that overflowed it, and at least double its size
+        size_t size = GB_IMAX (GB_arena.want, 2 * GB_arena.size) ;
+        size = GB_IMIN (size, GB_ARENA_MAX) ;
+        if (GB_arena.base != NULL) GB_Global_free_function (GB_arena.base) ;
+        GB_arena.base = GB_Global_malloc_function (size + GB_ARENA_ALIGN) ;
+        if (GB_arena.base == NULL)
+        {
+            // out of memory; continue without the arena
+            GB_arena.block = NULL ;
+            GB_arena.size = 0 ;
+        }
+        else
+        {
+            size_t offset = (size_t) GB_arena.base % GB_ARENA_ALIGN ;
+            GB_arena.block = ((uint8_t *) GB_arena.base) +
+                ((offset == 0) ? 0 : (GB_ARENA_ALIGN - offset)) ;
+            GB_arena.size = size ;
+            GB_arena_register ( ) ;
+        }
+    }
+
+    GB_arena.spill = 0 ;
+    GB_arena.want = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// GB_arena_malloc: allocate workspace from the arena
+//------------------------------------------------------------------------------
+
+// Space is not initialized.  Use GB_ARENA_MALLOC instead of calling this
+// function directly.
+
+void *GB_arena_malloc       // pointer to allocated block of memory
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item     // sizeof each item
+)
+{
+
+    if (!GB_Global_arena_get ( ))
+    {
+        // the arena is disabled
+        return (GB_malloc_memory (nitems, size_of_item)) ;
+    }
+
+    // make sure at least one item of at least one byte is allocated
+    nitems = GB_IMAX (1, nitems) ;
+    size_of_item = GB_IMAX (1, size_of_item) ;
+
+    size_t size ;
+    bool ok = GB_size_t_multiply (&size, nitems, size_of_item) ;
+    if (!ok || nitems > GB_INDEX_MAX || size_of_item > GB_INDEX_MAX)
+    {
+        // overflow
+        return (NULL) ;
+    }
+
+    // round up so the next block is also aligned
+    size = GB_ARENA_ALIGN * ((size + GB_ARENA_ALIGN - 1) / GB_ARENA_ALIGN) ;
+
+    if (GB_arena.live == 0)
+    {
+        GB_arena_reset ( ) ;
+    }
+
+    if (size <= GB_arena.size - GB_arena.used)
+    {
+        // the block fits in the arena
+        void *p = GB_arena.block + GB_arena.used ;
+        GB_arena.used += size ;
+        GB_arena.live++ ;
+        return (p) ;
+    }
+
+    // the block does not fit; use malloc_function and grow the arena later
+    GB_arena.spill += size ;
+    GB_arena.want = GB_IMAX (GB_arena.want, GB_arena.used + GB_arena.spill) ;
+    return (GB_malloc_memory (nitems, size_of_item)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_arena_realloc: reallocate workspace from the arena
+//------------------------------------------------------------------------------
+
+// Same as GB_realloc_memory, except that p may have been allocated from the
+// arena, and the new block is taken from the arena if possible.  Use
+// GB_ARENA_REALLOC instead of calling this function directly.
+
+void *GB_arena_realloc      // pointer to reallocated block of memory, or
+                            // to original block if the reallocation failed.
+(
+    size_t nitems_new,      // new number of items in the object
+    size_t nitems_old,      // old number of items in the object
+    size_t size_of_item,    // sizeof each item
+    void *p,                // old object to reallocate
+    bool *ok                // true if successful, false otherwise
+)
+{
+
+    if (p != NULL && !GB_ARENA_OWNS (p))
+    {
+        // p was allocated by GB_malloc_memory
+        return (GB_realloc_memory (nitems_new, nitems_old, size_of_item, p,
+            ok)) ;
+    }
+
+    void *pnew = GB_arena_malloc (nitems_new, size_of_item) ;
+    (*ok) = (pnew != NULL) ;
+    if (pnew == NULL)
+    {
+        // out of memory; the old block is unchanged
+        return (p) ;
+    }
+
+    if (p != NULL)
+    {
+        // copy the old content and free the old block
+        size_t n = GB_IMIN (GB_IMAX (1, nitems_old), GB_IMAX (1, nitems_new)) ;
+        memcpy (pnew, p, n * GB_IMAX (1, size_of_item)) ;
+        GB_arena_free (p) ;
+    }
+    return (pnew) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_arena_free: free workspace, if owned by the arena
+//------------------------------------------------------------------------------
+
+// Returns true if p was allocated from the arena of this thread, or false if
+// it must be freed by GB_free_memory instead.
+
+bool GB_arena_free          // free workspace, if owned by the arena
+(
+    void *p                 // block to free
+)
+{
+
+    if (p == NULL || !GB_ARENA_OWNS (p))
+    {
+        return (false) ;
+    }
+
+    ASSERT (GB_arena.live > 0) ;
+    GB_arena.live-- ;
+    if (GB_arena.live == 0)
+    {
+        // all blocks have been freed, so the entire arena is free
+        GB_arena.used = 0 ;
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_arena_finalize: free the arena of this thread
+//------------------------------------------------------------------------------
+
+void GB_arena_finalize (void)
+{
+    if (GB_arena.base != NULL)
+    {
+        GB_Global_free_function (GB_arena.base) ;
+    }
+    GB_arena.base = NULL ;
+    GB_arena.block = NULL ;
+    GB_arena.size = 0 ;
+    GB_arena.used = 0 ;
+    GB_arena.spill = 0 ;
+    GB_arena.want = 0 ;
+    GB_arena.live = 0 ;
+}
@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// GB_arena.h: definitions for the thread-local workspace arena
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_ARENA_H
+#define GB_ARENA_H
+
+// alignment of each block allocated from the arena
+#define GB_ARENA_ALIGN 64
+
+// the arena block is never grown beyond this size (in bytes)
+#define GB_ARENA_MAX ((size_t) 1 << 28)
+
+void *GB_arena_malloc       // allocate workspace from the arena
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item     // sizeof each item
+) ;
+
+void *GB_arena_realloc      // reallocate workspace from the arena
+(
+    size_t nitems_new,      // new number of items in the object
+    size_t nitems_old,      // old number of items in the object
+    size_t size_of_item,    // sizeof each item
+    void *p,                // old object to reallocate
+    bool *ok                // true if successful, false otherwise
+) ;
+
+bool GB_arena_free          // free workspace, if owned by the arena
+(
+    void *p                 // block to free
+) ;
+
+void GB_arena_finalize (void) ;     // free the arena of this thread
+
+#endif
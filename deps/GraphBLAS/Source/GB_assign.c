@@ -28,12 +28,14 @@
 #include "GB_subassign.h"
 #include "GB_subref.h"
 #include "GB_transpose.h"
+#include "GB_apply.h"
 
 #define GB_FREE_ALL                                     \
 {                                                       \
     GB_MATRIX_FREE (&Z2) ;                              \
     GB_MATRIX_FREE (&AT) ;                              \
     GB_MATRIX_FREE (&MT) ;                              \
+    GB_MATRIX_FREE (&MS) ;                              \
     GB_FREE_MEMORY (I2,  I2_size, sizeof (GrB_Index)) ; \
     GB_FREE_MEMORY (I2k, I2_size, sizeof (GrB_Index)) ; \
     GB_FREE_MEMORY (J2,  J2_size, sizeof (GrB_Index)) ; \
@@ -47,6 +49,7 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
     const bool C_replace,           // descriptor for C
     const GrB_Matrix M_in,          // optional mask for C
     const bool Mask_comp,           // true if mask is complemented
+    const bool Mask_struct,         // if true, use only the pattern of M
     bool M_transpose,               // true if the mask should be transposed
     const GrB_BinaryOp accum,       // optional accum for accum(C,T)
     const GrB_Matrix A_in,          // input matrix
@@ -71,6 +74,7 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
     GrB_Info info ;
     GrB_Matrix AT = NULL ;
     GrB_Matrix MT = NULL ;
+    GrB_Matrix MS = NULL ;
     GrB_Matrix Z = NULL ;
     GrB_Matrix Z2 = NULL ;
     GrB_Index *restrict I2  = NULL ;
@@ -230,6 +234,13 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
         }
     }
 
+    //--------------------------------------------------------------------------
+    // copy C if it is a view
+    //--------------------------------------------------------------------------
+
+    // a view cannot be modified in place; other pending work in C is kept
+    if (GB_IS_VIEW (C)) GB_WAIT_MATRIX (C) ;
+
     //--------------------------------------------------------------------------
     // quick return if an empty mask is complemented
     //--------------------------------------------------------------------------
@@ -333,6 +344,18 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
         GB_WAIT (A) ;
     }
 
+    //--------------------------------------------------------------------------
+    // use only the pattern of M, if requested
+    //--------------------------------------------------------------------------
+
+    // GB_subassigner reads the values of the mask, so a structural mask is
+    // replaced with a boolean shallow copy of M, with all values true
+    if (Mask_struct && M != NULL)
+    { 
+        GB_OK (GB_shallow_op (&MS, M->is_csc, GxB_ONE_BOOL, M, Context)) ;
+        M = MS ;
+    }
+
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format of C:
     //--------------------------------------------------------------------------
@@ -633,7 +656,7 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
 
         // This code requires Z and M_in not to be aliased to each other.
 
-        M = M_in ;
+        M = (MS != NULL) ? MS : M_in ;
         ASSERT (M != NULL) ;
         ASSERT (!GB_aliased (Z, M)) ;
 
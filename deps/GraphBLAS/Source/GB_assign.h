@@ -17,6 +17,7 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
     const bool C_replace,           // descriptor for C
     const GrB_Matrix M_in,          // optional mask for C
     const bool Mask_comp,           // true if mask is complemented
+    const bool Mask_struct,         // if true, use only the pattern of M
     bool M_transpose,               // true if the mask should be transposed
     const GrB_BinaryOp accum,       // optional accum for accum(C,T)
     const GrB_Matrix A_in,          // input matrix
@@ -111,6 +111,11 @@ GrB_Info GB_build               // build matrix
 
     ASSERT (C != NULL) ;
 
+    // start recording the telemetry of this operation (see GB_stats.c)
+    GB_Stats_mark stats ;
+    GB_stats_begin (&stats, NULL, NULL, NULL, Context) ;
+    GB_TRACE_BEGIN ("GB_build") ;
+
     //--------------------------------------------------------------------------
     // free all content of C
     //--------------------------------------------------------------------------
@@ -163,6 +168,7 @@ GrB_Info GB_build               // build matrix
     if (info != GrB_SUCCESS)
     { 
         // out of memory
+        GB_TRACE_END ("GB_build") ;
         return (info) ;
     }
 
@@ -170,6 +176,12 @@ GrB_Info GB_build               // build matrix
     // transplant and typecast T into C, conform C, and free T
     //--------------------------------------------------------------------------
 
-    return (GB_transplant_conform (C, C->type, &T, Context)) ;
+    info = GB_transplant_conform (C, C->type, &T, Context) ;
+    GB_TRACE_END ("GB_build") ;
+    if (info == GrB_SUCCESS)
+    { 
+        GB_stats_end (&stats, GxB_STATS_BUILD, C, Context) ;
+    }
+    return (info) ;
 }
 
@@ -29,7 +29,9 @@
 // STEP 1: copy user input.  O(e/p) read/write per thread, or skipped.
 
 // STEP 2: sort the tuples.  Time: O((e log e)/p), read/write, or skipped if
-//         the tuples are already sorted.
+//         the tuples are already sorted.  If the dimensions of the matrix are
+//         small enough that (j,i) fits in a 64-bit key, a radix sort is used
+//         instead, taking O((e/p) * b/8) time for a b-bit key.
 
 // STEP 3: count vectors and duplicates.  O(e/p) reads, per thread, if no
 //         duplicates, or skipped if already done.  O(e/p) read/writes
@@ -102,7 +104,7 @@
     GB_FREE_MEMORY (K_work,         nvals,  sizeof (int64_t)) ; \
     GB_FREE_MEMORY (W0,             nvals,  sizeof (int64_t)) ; \
     GB_FREE_MEMORY (W1,             nvals,  sizeof (int64_t)) ; \
-    GB_FREE_MEMORY (W1,             nvals,  sizeof (int64_t)) ; \
+    GB_FREE_MEMORY (W2,             nvals,  sizeof (int64_t)) ; \
 }
 
 //------------------------------------------------------------------------------
@@ -191,6 +193,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
 
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
     int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+    GB_STATS_KERNEL (GxB_DEFAULT, nthreads, nthreads, nvals) ;
 
     //--------------------------------------------------------------------------
     // partition the tuples for the threads
@@ -532,8 +535,42 @@ GrB_Info GB_builder                 // build a matrix from tuples
             K_work [k] = k ;
         }
 
+        // The (j,i) or i part of each tuple can be packed into a single
+        // 64-bit key if the dimensions are small enough.  If so, and if the
+        // list is not too short, a parallel radix sort is used.  Otherwise, a
+        // quicksort (one thread) or a parallel mergesort is used.
+        int ibits = GB_rsort_nbits (vlen) ;
+        int jbits = (vdim > 1) ? GB_rsort_nbits (vdim) : 0 ;
+        bool use_radix = (nvals >= GB_RSORT_MIN && ibits + jbits <= 64) ;
+
         // sort all the tuples
-        if (vdim > 1)
+        if (use_radix)
+        {
+
+            //------------------------------------------------------------------
+            // parallel radix sort of (j,i,k) or (i,k) tuples
+            //------------------------------------------------------------------
+
+            GB_MALLOC_MEMORY (W0, nvals, sizeof (int64_t)) ;
+            if (vdim <= 1)
+            { 
+                GB_MALLOC_MEMORY (W1, nvals, sizeof (int64_t)) ;
+            }
+            if (W0 == NULL || (vdim <= 1 && W1 == NULL))
+            { 
+                // out of memory
+                GB_FREE_WORK ;
+                return (GB_OUT_OF_MEMORY) ;
+            }
+
+            GB_rsort_3 ((vdim > 1) ? J_work : NULL, I_work, K_work, W0, W1,
+                nvals, ibits, jbits, nthreads) ;
+
+            GB_FREE_MEMORY (W0, nvals, sizeof (int64_t)) ;
+            GB_FREE_MEMORY (W1, nvals, sizeof (int64_t)) ;
+
+        }
+        else if (vdim > 1)
         {
 
             //------------------------------------------------------------------
@@ -945,6 +982,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
             GB_FREE_WORK ;
             return (GB_OUT_OF_MEMORY) ;
         }
+        GB_numa_place (T->i, tnz * sizeof (int64_t), nthreads) ;
     }
 
     int64_t *restrict Ti = T->i ;
@@ -1119,6 +1157,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
             GB_FREE_WORK ;
             return (GB_OUT_OF_MEMORY) ;
         }
+        GB_numa_place (T->x, tnz * ttype->size, nthreads) ;
 
         GB_void *restrict Tx = T->x ;
 
@@ -7,7 +7,8 @@
 
 //------------------------------------------------------------------------------
 
-// A wrapper for calloc_function.  Space is set to zero.
+// A wrapper for calloc_function.  Space is set to zero.  Large blocks may be
+// placed on transparent huge pages instead (see GB_hugepage.c).
 
 // This function is called via the GB_CALLOC_MEMORY(p,n,s) macro.
 
@@ -77,7 +78,7 @@ void *GB_calloc_memory      // pointer to allocated block of memory
             }
             else
             { 
-                p = (void *) GB_Global_calloc_function (nitems, size_of_item) ;
+                p = GB_hugepage_malloc (nitems, size_of_item, true) ;
             }
 
             // check if successful
@@ -121,9 +122,13 @@ void *GB_calloc_memory      // pointer to allocated block of memory
             // normal use, in production
             //------------------------------------------------------------------
 
-            p = (void *) GB_Global_calloc_function (nitems, size_of_item) ;
+            p = GB_hugepage_malloc (nitems, size_of_item, true) ;
         }
 
+        if (p != NULL)
+        { 
+            GB_Global_memory_update ((int64_t) size) ;
+        }
     }
     return (p) ;
 }
@@ -31,6 +31,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     const bool C_replace,           // if true, clear C before writing to it
     const GrB_Matrix M,             // optional mask for C, unused if NULL
     const bool Mask_comp,           // if true, complement the mask M
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
     const GrB_BinaryOp op,          // defines '+' for C=A+B, or .* for A.*B
     const GrB_Matrix A,             // input matrix
@@ -208,11 +209,13 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
 
     if (eWiseAdd)
     { 
-        GB_OK (GB_add (&T, T_type, C_is_csc, M1, A1, B1, op, Context)) ;
+        GB_OK (GB_add (&T, T_type, C_is_csc, M1, Mask_struct, A1, B1, op,
+            Context)) ;
     }
     else
     { 
-        GB_OK (GB_emult (&T, T_type, C_is_csc, M1, A1, B1, op, Context)) ;
+        GB_OK (GB_emult (&T, T_type, C_is_csc, M1, Mask_struct, A1, B1, op,
+            Context)) ;
     }
 
     //--------------------------------------------------------------------------
@@ -244,7 +247,8 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     { 
         // C<M> = accum (C,T)
         // GB_accum_mask also conforms C to its desired hypersparsity
-        info = GB_ACCUM_MASK (C, M, MT, accum, &T, C_replace, Mask_comp) ;
+        info = GB_ACCUM_MASK (C, M, MT, accum, &T, C_replace, Mask_comp,
+            Mask_struct) ;
         GB_MATRIX_FREE (&MT) ;
         return (info) ;
     }
@@ -53,7 +53,8 @@ GrB_Info GB_ewise_slice
     ASSERT (p_max_ntasks != NULL) ;
     ASSERT (p_ntasks != NULL) ;
     ASSERT (p_nthreads != NULL) ;
-    ASSERT_OK (GB_check (A, "A for ewise_slice", GB0)) ;
+    ASSERT_OK (GB_check (A, "A for ewise_slice",
+        GB_ZOMBIES (A) ? GB_FLIP (GB0) : GB0)) ;
     ASSERT_OK (GB_check (B, "B for ewise_slice", GB0)) ;
 
     (*p_TaskList  ) = NULL ;
@@ -129,7 +130,7 @@ GrB_Info GB_ewise_slice
     // allocate workspace
     //--------------------------------------------------------------------------
 
-    GB_MALLOC_MEMORY (Cwork, Cnvec+1, sizeof (int64_t)) ;
+    GB_ARENA_MALLOC (Cwork, Cnvec+1, sizeof (int64_t)) ;
     if (Cwork == NULL)
     { 
         // out of memory
@@ -455,6 +456,7 @@ GrB_Info GB_ewise_slice
                     GB_slice_vector (&i, &pM, &pA, &pB,
                         pM_start, pM_end, Mi,       // Mi NULL if M not present
                         pA_start, pA_end, Ai, 0,    // Ai always explicit list
+                        A->nzombies,                // only GB_wait has zombies
                         pB_start, pB_end, Bi,       // Bi always explicit list
                         vlen, target_work) ;
 
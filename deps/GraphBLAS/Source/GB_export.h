@@ -38,7 +38,34 @@
             nvals, GB_INDEX_MAX))) ;                            \
     }                                                           \
     /* get the descriptor */                                    \
-    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6) ;
+
+// GB_EXPORT_RELEASE (X, n, size): the array *X of n items, part of the content
+// of a matrix, is handed to the user, who frees it with free rather than
+// GB_free_memory.  It leaves GxB_MEMORY_INUSE and the record of huge-page
+// blocks here, or both would keep it.  GB_IMPORT_ACQUIRE is the reverse, for
+// an array of the user that becomes part of a matrix; both count the array as
+// GB_malloc_memory and GB_free_memory do.
+
+#define GB_CONTENT_BYTES(n,size)                                \
+    ((int64_t) (GB_IMAX (1, (n)) * GB_IMAX (1, (size))))
+
+#define GB_EXPORT_RELEASE(X,n,size)                             \
+{                                                               \
+    if ((*(X)) != NULL)                                         \
+    {                                                           \
+        GB_Global_memory_update (-GB_CONTENT_BYTES (n, size)) ; \
+        GB_hugepage_untrack (*(X)) ;                            \
+    }                                                           \
+}
+
+#define GB_IMPORT_ACQUIRE(X,n,size)                             \
+{                                                               \
+    if ((X) != NULL && (*(X)) != NULL)                          \
+    {                                                           \
+        GB_Global_memory_update (GB_CONTENT_BYTES (n, size)) ;  \
+    }                                                           \
+}
 
 #define GB_EXPORT_CHECK                                         \
     GB_RETURN_IF_NULL (A) ;                                     \
@@ -53,7 +80,8 @@
     GB_RETURN_IF_NULL (nvals) ;                                 \
     GB_RETURN_IF_NULL (nonempty) ;                              \
     /* get the descriptor */                                    \
-    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5) ;   \
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5,     \
+        xx6) ;                                                  \
     /* export basic attributes */                               \
     (*type) = (*A)->type ;                                      \
     (*nrows) = GB_NROWS (*A) ;                                  \
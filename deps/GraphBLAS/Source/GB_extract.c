@@ -29,6 +29,7 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     const bool C_replace,           // C matrix descriptor
     const GrB_Matrix M,             // optional mask for C, unused if NULL
     const bool Mask_comp,           // mask descriptor
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
     const GrB_Matrix A,             // input matrix
     const bool A_transpose,         // A matrix descriptor
@@ -187,6 +188,7 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     // C<M> = accum (C,T): accumulate the results into C via the mask M
     //--------------------------------------------------------------------------
 
-    return (GB_ACCUM_MASK (C, M, NULL, accum, &T, C_replace, Mask_comp)) ;
+    return (GB_ACCUM_MASK (C, M, NULL, accum, &T, C_replace, Mask_comp,
+        Mask_struct)) ;
 }
 
@@ -7,7 +7,8 @@
 
 //------------------------------------------------------------------------------
 
-// A wrapper for free.  If p is NULL on input, it is not freed.
+// A wrapper for free.  If p is NULL on input, it is not freed.  If p was
+// allocated from the workspace arena, it is returned to the arena instead.
 
 // This function is called via the GB_FREE_MEMORY(p,n,s) macro.
 
@@ -23,7 +24,7 @@ void GB_free_memory
     size_t size_of_item     // sizeof each item
 )
 {
-    if (p != NULL)
+    if (p != NULL && !GB_arena_free (p))
     { 
 
         if (GB_Global_malloc_tracking_get ( ))
@@ -78,6 +79,9 @@ void GB_free_memory
         // free the memory
         //----------------------------------------------------------------------
 
+        GB_Global_memory_update (-(int64_t)
+            (GB_IMAX (1, nitems) * GB_IMAX (1, size_of_item))) ;
+        GB_hugepage_untrack (p) ;
         GB_Global_free_function (p) ;
     }
 }
@@ -0,0 +1,318 @@
+//------------------------------------------------------------------------------
+// GB_hugepage: allocate large blocks on transparent huge pages
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The content of a large matrix (A->i and A->x in particular) can span
+// gigabytes, and random accesses into it (in the dot product kernels, for
+// example) miss in the TLB with the default 4KB pages.  If a threshold is set
+// by GxB_set (GxB_HUGE_PAGES, threshold), GB_malloc_memory and
+// GB_calloc_memory allocate each block of at least that many bytes aligned to
+// a 2MB boundary, and ask the kernel to back it with transparent huge pages
+// via madvise (MADV_HUGEPAGE).  A threshold of zero (the default) disables
+// huge pages.
+
+// The number of bytes currently allocated this way is reported by
+// GxB_get (GxB_HUGE_PAGE_BYTES, &bytes).  Whether the kernel actually backs
+// them with huge pages depends on /sys/kernel/mm/transparent_hugepage.
+
+// Huge pages are used only on Linux, and only if the default malloc/free
+// functions are in use, since the blocks are allocated with posix_memalign
+// and freed with free.  Each huge-page block is recorded, with its size, in a
+// hash table keyed by its address, and removed from it when GraphBLAS frees
+// it or hands it to the user in a GxB_*_export.  The 2MB alignment of a block
+// only serves to skip the table for the many blocks that cannot be in it; an
+// ordinary block from malloc can be 2MB aligned too.
+
+// These functions are defined here:
+
+//      GB_hugepage_malloc:     allocate a block, on huge pages if large enough
+//      GB_hugepage_owns:       true if a block is on huge pages
+//      GB_hugepage_untrack:    remove a block from the statistics before free
+
+#if defined ( __linux__ )
+// posix_memalign and madvise are not declared in strict ANSI C11 mode
+#define _DEFAULT_SOURCE
+#endif
+
+#include "GB.h"
+
+#if defined ( __linux__ )
+#include <sys/mman.h>
+#if defined ( MADV_HUGEPAGE )
+#define GB_HAS_HUGEPAGE 1
+#endif
+#endif
+
+#ifdef GB_HAS_HUGEPAGE
+
+//------------------------------------------------------------------------------
+// registry of the huge-page blocks
+//------------------------------------------------------------------------------
+
+// An open-addressing hash table with linear probing, of size a power of 2 and
+// at most half full (counting deleted entries).  It is allocated with malloc
+// and free, which are the memory functions whenever huge pages are enabled,
+// and freed when it becomes empty.  All access is in a critical section.
+
+#define GB_HUGEPAGE_DELETED ((void *) (&GB_hugepage_registry))
+
+static struct
+{
+    void **block ;          // address of each block, NULL if the slot is empty
+    size_t *size ;          // size of each block
+    int64_t nslots ;        // size of the table
+    int64_t nblocks ;       // # of blocks in the table
+    int64_t nused ;         // nblocks plus the # of deleted slots
+}
+GB_hugepage_registry = { NULL, NULL, 0, 0, 0 } ;
+
+// the first slot to probe for a block
+static inline int64_t GB_hugepage_hash (void *p, int64_t nslots)
+{ 
+    uint64_t k = ((uint64_t) p) / GB_HUGEPAGE_SIZE ;
+    return ((int64_t) ((k * 0x9E3779B97F4A7C15ULL) >> 32) & (nslots - 1)) ;
+}
+
+// the slot of block p, or -1 if p is not in the table
+static int64_t GB_hugepage_find (void *p)
+{
+    int64_t nslots = GB_hugepage_registry.nslots ;
+    if (GB_hugepage_registry.nblocks == 0) return (-1) ;
+    for (int64_t k = GB_hugepage_hash (p, nslots) ; ; k = (k+1) & (nslots-1))
+    {
+        void *q = GB_hugepage_registry.block [k] ;
+        if (q == p) return (k) ;
+        if (q == NULL) return (-1) ;
+    }
+}
+
+// rebuild the table with nslots slots, dropping the deleted entries
+static bool GB_hugepage_rehash (int64_t nslots)
+{
+    void **block = calloc (nslots, sizeof (void *)) ;
+    size_t *size = malloc (nslots * sizeof (size_t)) ;
+    if (block == NULL || size == NULL)
+    { 
+        free (block) ;
+        free (size) ;
+        return (false) ;
+    }
+    for (int64_t j = 0 ; j < GB_hugepage_registry.nslots ; j++)
+    {
+        void *q = GB_hugepage_registry.block [j] ;
+        if (q == NULL || q == GB_HUGEPAGE_DELETED) continue ;
+        int64_t k = GB_hugepage_hash (q, nslots) ;
+        while (block [k] != NULL)
+        { 
+            k = (k+1) & (nslots-1) ;
+        }
+        block [k] = q ;
+        size [k] = GB_hugepage_registry.size [j] ;
+    }
+    free (GB_hugepage_registry.block) ;
+    free (GB_hugepage_registry.size) ;
+    GB_hugepage_registry.block = block ;
+    GB_hugepage_registry.size = size ;
+    GB_hugepage_registry.nslots = nslots ;
+    GB_hugepage_registry.nused = GB_hugepage_registry.nblocks ;
+    return (true) ;
+}
+
+// add block p of the given size; false if out of memory
+static bool GB_hugepage_insert (void *p, size_t size)
+{
+    bool ok = true ;
+    #pragma omp critical (GB_hugepage)
+    {
+        if (2 * (GB_hugepage_registry.nused + 1) > GB_hugepage_registry.nslots)
+        { 
+            // keep the table at most half full
+            int64_t nslots = 64 ;
+            while (nslots < 4 * (GB_hugepage_registry.nblocks + 1))
+            { 
+                nslots *= 2 ;
+            }
+            ok = GB_hugepage_rehash (nslots) ;
+        }
+        if (ok)
+        {
+            int64_t nslots = GB_hugepage_registry.nslots ;
+            int64_t k = GB_hugepage_hash (p, nslots) ;
+            while (GB_hugepage_registry.block [k] != NULL &&
+                   GB_hugepage_registry.block [k] != GB_HUGEPAGE_DELETED)
+            { 
+                k = (k+1) & (nslots-1) ;
+            }
+            if (GB_hugepage_registry.block [k] == NULL)
+            { 
+                GB_hugepage_registry.nused++ ;
+            }
+            GB_hugepage_registry.block [k] = p ;
+            GB_hugepage_registry.size [k] = size ;
+            GB_hugepage_registry.nblocks++ ;
+        }
+    }
+    return (ok) ;
+}
+
+// remove block p and return its size, or zero if p is not in the table
+static size_t GB_hugepage_remove (void *p)
+{
+    size_t size = 0 ;
+    #pragma omp critical (GB_hugepage)
+    {
+        int64_t k = GB_hugepage_find (p) ;
+        if (k >= 0)
+        {
+            size = GB_hugepage_registry.size [k] ;
+            GB_hugepage_registry.block [k] = GB_HUGEPAGE_DELETED ;
+            if (--GB_hugepage_registry.nblocks == 0)
+            { 
+                // free the table once the last block is gone
+                free (GB_hugepage_registry.block) ;
+                free (GB_hugepage_registry.size) ;
+                GB_hugepage_registry.block = NULL ;
+                GB_hugepage_registry.size = NULL ;
+                GB_hugepage_registry.nslots = 0 ;
+                GB_hugepage_registry.nused = 0 ;
+            }
+        }
+    }
+    return (size) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_hugepage_malloc: allocate a block, on huge pages if large enough
+//------------------------------------------------------------------------------
+
+// If do_calloc is true, the space is set to zero.  Otherwise it is not
+// initialized.
+
+void *GB_hugepage_malloc    // pointer to allocated block of memory
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    bool do_calloc          // if true, set the space to zero
+)
+{
+
+    size_t size = nitems * size_of_item ;   // cannot overflow; see caller
+
+    #ifdef GB_HAS_HUGEPAGE
+    size_t threshold = GB_Global_hugepage_threshold_get ( ) ;
+    if (threshold > 0 && size >= threshold)
+    {
+        // round up to a whole number of huge pages
+        size_t hsize = GB_HUGEPAGE_SIZE *
+            ((size + GB_HUGEPAGE_SIZE - 1) / GB_HUGEPAGE_SIZE) ;
+        void *p = NULL ;
+        if (posix_memalign (&p, GB_HUGEPAGE_SIZE, hsize) != 0)
+        { 
+            p = NULL ;
+        }
+        else if (p != NULL && !GB_hugepage_insert (p, hsize))
+        { 
+            // no room to record the block; use malloc instead
+            free (p) ;
+            p = NULL ;
+        }
+        if (p != NULL)
+        {
+            // failure of madvise is not an error; the block is still usable
+            madvise (p, hsize, MADV_HUGEPAGE) ;
+            if (do_calloc)
+            {
+                // Zero the block in parallel, each thread a contiguous slice
+                // of whole pages, with the static partition GB_numa_place
+                // uses.  Each page is first touched by the thread that owns
+                // its slice, as it would be by a parallel loop filling it.
+                int64_t npages = (int64_t) (hsize / GB_NUMA_PAGE) ;
+                int nthreads = GB_nthreads ((double) hsize,
+                    GB_Global_chunk_get ( ), GB_Global_nthreads_max_get ( )) ;
+                GB_void *restrict page = (GB_void *) p ;
+                #pragma omp parallel for num_threads(nthreads) schedule(static)
+                for (int64_t k = 0 ; k < npages ; k++)
+                { 
+                    memset (page + k * GB_NUMA_PAGE, 0, GB_NUMA_PAGE) ;
+                }
+            }
+            GB_Global_hugepage_inuse_increment ((int64_t) hsize) ;
+            if (GB_Global_stats_get ( ))
+            { 
+                GB_Global_stats_bytes_increment ((int64_t) hsize) ;
+            }
+            return (p) ;
+        }
+        // otherwise, fall back to malloc_function or calloc_function
+    }
+    #endif
+
+    void *p ;
+    if (do_calloc)
+    {
+        p = GB_Global_calloc_function (nitems, size_of_item) ;
+    }
+    else
+    {
+        p = GB_Global_malloc_function (size) ;
+    }
+    if (p != NULL && GB_Global_stats_get ( ))
+    { 
+        GB_Global_stats_bytes_increment ((int64_t) size) ;
+    }
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_hugepage_owns: true if a block was allocated on huge pages
+//------------------------------------------------------------------------------
+
+bool GB_hugepage_owns
+(
+    void *p                 // block to check
+)
+{
+    #ifdef GB_HAS_HUGEPAGE
+    if (p == NULL || ((size_t) p) % GB_HUGEPAGE_SIZE != 0)
+    { 
+        // every huge-page block is 2MB aligned
+        return (false) ;
+    }
+    bool owns ;
+    #pragma omp critical (GB_hugepage)
+    { 
+        owns = (GB_hugepage_find (p) >= 0) ;
+    }
+    return (owns) ;
+    #else
+    return (false) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_hugepage_untrack: remove a block from the statistics, just before free
+//------------------------------------------------------------------------------
+
+void GB_hugepage_untrack
+(
+    void *p                 // block about to be freed
+)
+{
+    #ifdef GB_HAS_HUGEPAGE
+    if (p != NULL && ((size_t) p) % GB_HUGEPAGE_SIZE == 0)
+    {
+        size_t size = GB_hugepage_remove (p) ;
+        if (size > 0)
+        { 
+            GB_Global_hugepage_inuse_decrement ((int64_t) size) ;
+        }
+    }
+    #endif
+}
@@ -170,7 +170,10 @@ GrB_Info GB_init            // start up GraphBLAS
     // queue must be protected and can be initialized only once by any thread.
 
     // clear the queue
-    GB_Global_queue_head_set (NULL) ;
+    for (int shard = 0 ; shard < GB_QUEUE_NSHARDS ; shard++)
+    { 
+        GB_Global_queue_head_set (shard, NULL) ;
+    }
 
     // set the mode: blocking or nonblocking
     GB_Global_mode_set (mode) ;
@@ -33,9 +33,9 @@ bool GB_is_diagonal             // true if A is diagonal
     int64_t n     = GB_NROWS (A) ;
     int64_t ncols = GB_NCOLS (A) ;
 
-    if (n != ncols)
+    if (n != ncols || GB_IS_VIEW (A))
     { 
-        // A is rectangular
+        // A is rectangular, or a view (which is never treated as diagonal)
         return (false) ;
     }
 
@@ -65,6 +65,18 @@ GrB_Info GB_ix_alloc        // allocate A->i and A->x space in a matrix
         return (GB_OUT_OF_MEMORY) ;
     }
 
+    //--------------------------------------------------------------------------
+    // place the new content on the NUMA nodes of the threads that will use it
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (A->nzmax, chunk, nthreads_max) ;
+    GB_numa_place (A->i, A->nzmax * sizeof (int64_t), nthreads) ;
+    if (numeric)
+    { 
+        GB_numa_place (A->x, A->nzmax * A->type->size, nthreads) ;
+    }
+
     return (GrB_SUCCESS) ;
 }
 
@@ -7,7 +7,8 @@
 
 //------------------------------------------------------------------------------
 
-// A wrapper for malloc_function.  Space is not initialized.
+// A wrapper for malloc_function.  Space is not initialized.  Large blocks may
+// be placed on transparent huge pages instead (see GB_hugepage.c).
 
 // This function is called via the GB_MALLOC_MEMORY(p,n,s) macro.
 
@@ -77,7 +78,7 @@ void *GB_malloc_memory      // pointer to allocated block of memory
             }
             else
             { 
-                p = (void *) GB_Global_malloc_function (size) ;
+                p = GB_hugepage_malloc (nitems, size_of_item, false) ;
             }
 
             // check if successful
@@ -121,9 +122,13 @@ void *GB_malloc_memory      // pointer to allocated block of memory
             // normal use, in production
             //------------------------------------------------------------------
 
-            p = (void *) GB_Global_malloc_function (size) ;
+            p = GB_hugepage_malloc (nitems, size_of_item, false) ;
         }
 
+        if (p != NULL)
+        { 
+            GB_Global_memory_update ((int64_t) size) ;
+        }
     }
     return (p) ;
 }
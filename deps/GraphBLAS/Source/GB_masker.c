@@ -55,6 +55,7 @@ GrB_Info GB_masker          // R = masker (M, C, Z)
     const bool R_is_csc,    // format of output matrix R
     const GrB_Matrix M,     // required input mask
     const bool Mask_comp,   // descriptor for M
+    const bool Mask_struct, // if true, use only the pattern of M
     const GrB_Matrix C,     // input C matrix
     const GrB_Matrix Z,     // input Z matrix
     GB_Context Context
@@ -139,7 +140,7 @@ GrB_Info GB_masker          // R = masker (M, C, Z)
         // from phase0:
         Rnvec, Rh, R_to_M, R_to_C, R_to_Z,
         // original input:
-        M, Mask_comp, C, Z, Context) ;
+        M, Mask_comp, Mask_struct, C, Z, Context) ;
 
     if (info != GrB_SUCCESS)
     { 
@@ -169,7 +170,7 @@ GrB_Info GB_masker          // R = masker (M, C, Z)
         // from phase0:
         Rnvec, Rh, R_to_M, R_to_C, R_to_Z,
         // original input:
-        M, Mask_comp, C, Z, Context) ;
+        M, Mask_comp, Mask_struct, C, Z, Context) ;
 
     // free workspace
     GB_FREE_MEMORY (TaskList, max_ntasks+1, sizeof (GB_task_struct)) ;
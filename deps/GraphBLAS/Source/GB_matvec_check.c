@@ -153,10 +153,11 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
 
     #ifdef GB_DEVELOPER
 
-    // a matrix contains 1 to 9 different allocated blocks
+    // a matrix contains 1 to 10 different allocated blocks
     int64_t nallocs = 1 +                       // header
         (A->h != NULL && !A->h_shallow) +       // A->h, if not shallow
         (A->p != NULL && !A->p_shallow) +       // A->p, if not shallow
+        (A->e != NULL) +                        // A->e, if A is a view
         (A->i != NULL && !A->i_shallow) +       // A->i, if not shallow
         (A->x != NULL && !A->x_shallow) +       // A->x, if not shallow
         (Pending != NULL) +
@@ -206,8 +207,23 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
     if (pr > 1) GBPR ("->p: %p shallow: %d\n", A->p, A->p_shallow) ;
     if (pr > 1) GBPR ("->i: %p shallow: %d\n", A->i, A->i_shallow) ;
     if (pr > 1) GBPR ("->x: %p shallow: %d\n", A->x, A->x_shallow) ;
+    if (pr > 1) GBPR ("->e: %p\n", A->e) ;
     #endif
 
+    bool A_is_view = GB_IS_VIEW (A) ;
+    if (A_is_view)
+    {
+        // a view must have shallow i and x content, unless it is empty, and
+        // cannot be a slice
+        if (A->is_slice || (A->nzmax > 0 && (!A->i_shallow || !A->x_shallow)))
+        { 
+            GBPR0 ("invalid view %s\n", kind) ;
+            return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+                "invalid view %s [%s]\n", kind, GB_NAME))) ;
+        }
+        GBPR0 ("view of another matrix\n") ;
+    }
+
     if (A->is_slice)
     {
         // a slice or hyperslice must have shallow i and x content
@@ -332,22 +348,50 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
     // check the content of p
     //--------------------------------------------------------------------------
 
-    if (A->is_slice ? (A->p [0] < 0) : (A->p [0] != 0))
+    if ((A->is_slice || A_is_view) ? (A->p [0] < 0) : (A->p [0] != 0))
     { 
         GBPR0 ("->p [0] = "GBd" invalid\n", A->p [0]) ;
         return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
             "%s A->p [0] = "GBd" invalid: [%s]", kind, A->p [0], GB_NAME))) ;
     }
 
-    for (int64_t j = 0 ; j < A->nvec ; j++)
+    if (A_is_view)
     {
-        if (A->p [j+1] < A->p [j] || A->p [j+1] > A->nzmax)
+        // the kth vector of a view is in A->i [A->p [k] ... A->e [k]-1], and
+        // A->p [nvec] is A->p [0] plus the number of entries in the view
+        int64_t vnz = 0 ;
+        for (int64_t k = 0 ; k < A->nvec ; k++)
+        {
+            if (A->p [k] < 0 || A->e [k] < A->p [k] || A->e [k] > A->nzmax)
+            { 
+                GBPR0 ("->e ["GBd"] = "GBd" invalid\n", k, A->e [k]) ;
+                return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+                    "%s A->e ["GBd"] = "GBd" invalid: [%s]",
+                    kind, k, A->e [k], GB_NAME))) ;
+            }
+            vnz += A->e [k] - A->p [k] ;
+        }
+        if (A->nvec > 0 && A->p [A->nvec] != A->p [0] + vnz)
         { 
-            GBPR0 ("->p ["GBd"] = "GBd" invalid\n",
-                j+1, A->p [j+1]) ;
+            GBPR0 ("->p ["GBd"] = "GBd" invalid\n", A->nvec,
+                A->p [A->nvec]) ;
             return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
                 "%s A->p ["GBd"] = "GBd" invalid: [%s]",
-                kind, j+1, A->p [j+1], GB_NAME))) ;
+                kind, A->nvec, A->p [A->nvec], GB_NAME))) ;
+        }
+    }
+    else
+    {
+        for (int64_t j = 0 ; j < A->nvec ; j++)
+        {
+            if (A->p [j+1] < A->p [j] || A->p [j+1] > A->nzmax)
+            { 
+                GBPR0 ("->p ["GBd"] = "GBd" invalid\n",
+                    j+1, A->p [j+1]) ;
+                return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+                    "%s A->p ["GBd"] = "GBd" invalid: [%s]",
+                    kind, j+1, A->p [j+1], GB_NAME))) ;
+            }
         }
     }
 
@@ -424,7 +468,10 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
     GBI_for_each_vector (A)
     {
         int64_t ilast = -1 ;
-        GBI_for_each_entry (j, p, pend)
+        GBI_jth_iteration (j, p, pend) ;
+        // the kth vector of a view ends at A->e [k]
+        if (A_is_view) pend = A->e [Iter_k] ;
+        for ( ; p < pend ; p++)
         {
             bool prcol = ((pr > 1 && jcount < GB_NBRIEF) || pr > 2) ;
             if (ilast == -1)
@@ -649,32 +696,20 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
                 GB_NAME, enqd, GB_IS_IN_QUEUE (A)))) ;
         }
 
-        if (GB_PENDING (A) || GB_ZOMBIES (A))
-        {
-            if (!enqd)
-            { 
-                GBPR0 ("must be in queue but is not there\n") ;
-                return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
-                "%s must be in queue but is not there: [%s]", kind, GB_NAME))) ;
-            }
-
-            // prev is NULL if and only if A is at the head of the queue
-            if ((prev == NULL) != (head == A))
-            { 
-                GBPR0 ("invalid queue\n") ;
-                return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
-                    "%s invalid queue: [%s]", kind, GB_NAME))) ;
-            }
+        if ((GB_PENDING (A) || GB_ZOMBIES (A)) && !enqd)
+        { 
+            GBPR0 ("must be in queue but is not there\n") ;
+            return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+            "%s must be in queue but is not there: [%s]", kind, GB_NAME))) ;
         }
-        else
-        {
-            if (enqd)
-            { 
-                GBPR0 ("must not be in queue but is there\n") ;
-                return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
-                    "%s must not be in queue but present there: [%s]",
-                    kind, GB_NAME))) ;
-            }
+
+        // A may be in the queue even if it has no pending work.
+        // prev is NULL if and only if A is at the head of its shard
+        if (enqd && ((prev == NULL) != (head == A)))
+        { 
+            GBPR0 ("invalid queue\n") ;
+            return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+                "%s invalid queue: [%s]", kind, GB_NAME))) ;
         }
     }
 
@@ -15,12 +15,19 @@
 #include "GB_mxm.h"
 #include "GB_accum_mask.h"
 
+// end the trace of the operation if it fails after it starts
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_TRACE_END ("GrB_mxm") ;              \
+}
+
 GrB_Info GB_mxm                     // C<M> = A*B
 (
     GrB_Matrix C,                   // input/output matrix for results
     const bool C_replace,           // if true, clear C before writing to it
     const GrB_Matrix M,             // optional mask for C, unused if NULL
     const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
     const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
     const GrB_Matrix A,             // input matrix
@@ -95,11 +102,18 @@ GrB_Info GB_mxm                     // C<M> = A*B
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp) ;
 
-    // delete any lingering zombies and assemble any pending tuples
+    // start recording the telemetry of this operation (see GB_stats.c)
+    GB_Stats_mark stats ;
+    GB_stats_begin (&stats, A, B, M, Context) ;
+    GB_TRACE_BEGIN ("GrB_mxm") ;
+
+    // delete any lingering zombies and assemble any pending tuples.  Views
+    // are kept, since GB_AxB_meta can use them for C<M>=A'*B.  This is
+    // GB_WAIT_KEEP_VIEW, except that the trace is ended if it fails.
     // GB_WAIT (C) ;
-    GB_WAIT (M) ;
-    GB_WAIT (A) ;
-    GB_WAIT (B) ;
+    if (GB_PENDING_OR_ZOMBIES (M)) GB_OK (GB_wait ((GrB_Matrix) M, Context)) ;
+    if (GB_PENDING_OR_ZOMBIES (A)) GB_OK (GB_wait ((GrB_Matrix) A, Context)) ;
+    if (GB_PENDING_OR_ZOMBIES (B)) GB_OK (GB_wait ((GrB_Matrix) B, Context)) ;
 
     //--------------------------------------------------------------------------
     // T = A*B, A'*B, A*B', or A'*B', also using the mask to cut time and memory
@@ -110,8 +124,8 @@ GrB_Info GB_mxm                     // C<M> = A*B
     bool mask_applied = false ;
     bool C_is_csc = C->is_csc ;
     GrB_Matrix T, MT = NULL ;
-    info = GB_AxB_meta (&T, C_is_csc, &MT, M, Mask_comp, A, B, semiring,
-        A_transpose, B_transpose, flipxy, &mask_applied, AxB_method,
+    info = GB_AxB_meta (&T, C_is_csc, &MT, M, Mask_comp, Mask_struct, A, B,
+        semiring, A_transpose, B_transpose, flipxy, &mask_applied, AxB_method,
         &(C->AxB_method_used), Context) ;
 
     if (info != GrB_SUCCESS)
@@ -119,6 +133,7 @@ GrB_Info GB_mxm                     // C<M> = A*B
         // out of memory
         ASSERT (T == NULL) ;
         ASSERT (MT == NULL) ;
+        GB_FREE_ALL ;
         return (info) ;
     }
 
@@ -141,9 +156,10 @@ GrB_Info GB_mxm                     // C<M> = A*B
         // transplanted directly into C, as C = (ctype) T, typecasting if
         // needed.  If no typecasting is done then this takes no time at all
         // and is a pure transplant.  Also conform C to its desired
-        // hypersparsity.
-        GB_MATRIX_FREE (&MT) ;
+        // hypersparsity.  T may share the pattern of MT (see GB_AxB_dot3),
+        // so MT is freed only after the transplant.
         info = GB_transplant_conform (C, C->type, &T, Context) ;
+        GB_MATRIX_FREE (&MT) ;
         #ifdef GB_DEBUG
         if (info == GrB_SUCCESS)
         {
@@ -158,7 +174,8 @@ GrB_Info GB_mxm                     // C<M> = A*B
     { 
         // C<M> = accum (C,T)
         // GB_accum_mask also conforms C to its desired hypersparsity
-        info = GB_ACCUM_MASK (C, M, MT, accum, &T, C_replace, Mask_comp) ;
+        info = GB_ACCUM_MASK (C, M, MT, accum, &T, C_replace, Mask_comp,
+            Mask_struct) ;
         GB_MATRIX_FREE (&MT) ;
         #ifdef GB_DEBUG
         if (info == GrB_SUCCESS)
@@ -175,6 +192,11 @@ GrB_Info GB_mxm                     // C<M> = A*B
     // return result
     //--------------------------------------------------------------------------
 
+    GB_TRACE_END ("GrB_mxm") ;
+    if (info == GrB_SUCCESS)
+    { 
+        GB_stats_end (&stats, GxB_STATS_MXM, C, Context) ;
+    }
     return (info) ;
 }
 
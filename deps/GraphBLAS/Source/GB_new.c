@@ -146,6 +146,7 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->nzmax = 0 ;              // GB_NNZ(A) checks nzmax==0 before Ap[nvec]
     A->i_shallow = false ;
     A->x_shallow = false ;
+    A->e = NULL ;               // A is not a view
     A->nzombies = 0 ;
     A->Pending = NULL ;
 
@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+// GB_numa_place: place a newly allocated array on the NUMA nodes
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// On a multi-socket machine, each page of memory lives on the NUMA node of
+// the thread that first touches it.  An array allocated by malloc and then
+// filled by a single thread lives entirely on one node, and the parallel
+// kernels that later read it from the other sockets pay for remote accesses.
+
+// GB_numa_place is called just after the content of a matrix (A->i or A->x)
+// is allocated, and before it is written.  The policy is selected by
+// GxB_set (GxB_NUMA, policy):
+
+//  GxB_NUMA_NONE:  nothing is done (the default).
+
+//  GxB_NUMA_FIRST_TOUCH:  each page is touched by one of nthreads threads,
+//      with the same static partition as the parallel loops that fill and
+//      read the array, so each thread's slice lives on its own node.
+
+//  GxB_NUMA_INTERLEAVE:  the pages are interleaved across all nodes (Linux
+//      only), and then touched as for GxB_NUMA_FIRST_TOUCH.
+
+// The content of the array is not modified, so this function can be used for
+// space from GB_malloc_memory or GB_calloc_memory.  Small arrays are not
+// placed.  Any failure is ignored, since placement only affects performance.
+
+#if defined ( __linux__ )
+// syscall is not declared in strict ANSI C11 mode
+#define _DEFAULT_SOURCE
+#endif
+
+#include "GB.h"
+
+#if defined ( __linux__ )
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+// arrays smaller than this are left where they are
+#define GB_NUMA_MIN (1024*1024)
+
+// from <numaif.h>, which is not always installed
+#define GB_MPOL_INTERLEAVE 3
+
+void GB_numa_place
+(
+    void *p,                    // array to place
+    size_t n,                   // size of the array, in bytes
+    int nthreads                // # of threads that will use the array
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GxB_NUMA_Policy policy = GB_Global_numa_get ( ) ;
+    if (p == NULL || policy == GxB_NUMA_NONE || n < GB_NUMA_MIN)
+    {
+        return ;
+    }
+
+    // find the pages entirely inside p [0..n-1]
+    size_t first = ((size_t) p + GB_NUMA_PAGE - 1) / GB_NUMA_PAGE ;
+    size_t last  = ((size_t) p + n) / GB_NUMA_PAGE ;
+    if (first >= last)
+    {
+        return ;
+    }
+    int64_t npages = (int64_t) (last - first) ;
+    GB_void *restrict page = (GB_void *) (first * GB_NUMA_PAGE) ;
+
+    //--------------------------------------------------------------------------
+    // interleave the pages across all nodes
+    //--------------------------------------------------------------------------
+
+    #if defined ( __linux__ ) && defined ( SYS_mbind )
+    if (policy == GxB_NUMA_INTERLEAVE)
+    {
+        // the kernel restricts the mask to the nodes that have memory
+        unsigned long nodemask [4] = { ~0UL, ~0UL, ~0UL, ~0UL } ;
+        syscall (SYS_mbind, page, (size_t) npages * GB_NUMA_PAGE,
+            GB_MPOL_INTERLEAVE, nodemask, 4 * 8 * sizeof (unsigned long), 0) ;
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // touch each page from the thread that owns its slice of the array
+    //--------------------------------------------------------------------------
+
+    nthreads = GB_IMAX (nthreads, 1) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int64_t k = 0 ; k < npages ; k++)
+    {
+        volatile GB_void *c = page + k * GB_NUMA_PAGE ;
+        (*c) = (*c) ;
+    }
+}
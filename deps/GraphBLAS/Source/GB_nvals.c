@@ -22,8 +22,9 @@ GrB_Info GB_nvals           // get the number of entries in a matrix
     //--------------------------------------------------------------------------
 
     // delete any lingering zombies and assemble any pending tuples
-    // do this as early as possible (see Table 2.4 in spec)
-    GB_WAIT (A) ;
+    // do this as early as possible (see Table 2.4 in spec).  The number of
+    // entries in a view is known, so it need not be copied.
+    GB_WAIT_KEEP_VIEW (A) ;
 
     // only now check nvals, for both GrB_Matrix_nvals and GrB_Vector_nvals
     GB_RETURN_IF_NULL (nvals) ;
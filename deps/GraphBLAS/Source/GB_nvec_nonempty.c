@@ -8,7 +8,7 @@
 //------------------------------------------------------------------------------
 
 // All pending tuples are ignored.  If a vector has all zombies it is still
-// counted as non-empty.
+// counted as non-empty.  The kth vector of a view is Ap [k] to Ae [k]-1.
 
 #include "GB.h"
 
@@ -50,12 +50,13 @@ int64_t GB_nvec_nonempty        // return # of non-empty vectors
 
     int64_t nvec_nonempty = 0 ;
     const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ae = GB_VECTOR_ENDS (A) ;
 
     #pragma omp parallel for num_threads(nthreads) schedule(static) \
             reduction(+:nvec_nonempty)
     for (int64_t k = 0 ; k < anvec ; k++)
     { 
-        if (Ap [k] < Ap [k+1]) nvec_nonempty++ ;
+        if (Ap [k] < Ae [k]) nvec_nonempty++ ;
     }
 
     ASSERT (nvec_nonempty >= 0 && nvec_nonempty <= A->vdim) ;
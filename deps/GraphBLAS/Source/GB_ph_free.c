@@ -7,10 +7,11 @@
 
 //------------------------------------------------------------------------------
 
-// Free the A->p and A->h content of a matrix.  If followed by GB_ix_free(A),
-// the header of A is just like GB_new with GB_Ap_null.  No content is left
-// except the header.  The matrix becomes invalid, and would generate a
-// GrB_INVALID_OBJECT error if passed to a user-callable GraphBLAS function.
+// Free the A->p and A->h content of a matrix (and A->e, if A is a view).  If
+// followed by GB_ix_free(A), the header of A is just like GB_new with
+// GB_Ap_null.  No content is left except the header.  The matrix becomes
+// invalid, and would generate a GrB_INVALID_OBJECT error if passed to a
+// user-callable GraphBLAS function.
 
 #include "GB.h"
 
@@ -43,6 +44,9 @@ void GB_ph_free                 // free A->p and A->h of a matrix
     A->h = NULL ;
     A->h_shallow = false ;
 
+    // free the vector ends of a view (never shallow)
+    GB_FREE_MEMORY (A->e, A->plen+1, sizeof (int64_t)) ;
+
     if (A->is_hyper)
     { 
         A->plen = 0 ;
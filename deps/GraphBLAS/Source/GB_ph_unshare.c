@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+// GB_ph_unshare: copy-on-write for the A->p and A->h content of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// A->p and A->h may be shallow copies of another matrix.  For example, the
+// output of GB_AxB_dot3 shares the vector pointers and hyperlist of its mask.
+// This is safe as long as A->p and A->h are only read.  Any method that
+// modifies them in place must first call this function, which replaces any
+// shallow A->p and A->h with private copies.  Nothing is done if A->p and A->h
+// are already private.  A->i and A->x are not modified.
+
+// If out of memory, A is unchanged.
+
+#include "GB.h"
+
+GrB_Info GB_ph_unshare          // make A->p and A->h private to A
+(
+    GrB_Matrix A,               // matrix that may share A->p and A->h
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL) ;
+    ASSERT (!GB_IS_VIEW (A)) ;
+
+    bool copy_p = A->p_shallow && A->p != NULL ;
+    bool copy_h = A->h_shallow && A->h != NULL ;
+    if (!copy_p && !copy_h)
+    { 
+        // A->p and A->h are already private (or NULL)
+        A->p_shallow = false ;
+        A->h_shallow = false ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int64_t anvec = A->nvec ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the new A->p and A->h
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Ap_new = NULL ;
+    int64_t *restrict Ah_new = NULL ;
+
+    if (copy_p)
+    { 
+        GB_MALLOC_MEMORY (Ap_new, A->plen+1, sizeof (int64_t)) ;
+    }
+    if (copy_h)
+    { 
+        GB_MALLOC_MEMORY (Ah_new, A->plen, sizeof (int64_t)) ;
+    }
+
+    if ((copy_p && Ap_new == NULL) || (copy_h && Ah_new == NULL))
+    { 
+        // out of memory
+        GB_FREE_MEMORY (Ap_new, A->plen+1, sizeof (int64_t)) ;
+        GB_FREE_MEMORY (Ah_new, A->plen,   sizeof (int64_t)) ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the vector pointers and hyperlist, and replace them in A
+    //--------------------------------------------------------------------------
+
+    if (copy_p)
+    { 
+        GB_memcpy (Ap_new, A->p, (anvec+1) * sizeof (int64_t), nthreads) ;
+        A->p = Ap_new ;
+    }
+    if (copy_h)
+    { 
+        GB_memcpy (Ah_new, A->h, anvec * sizeof (int64_t), nthreads) ;
+        A->h = Ah_new ;
+    }
+
+    A->p_shallow = false ;
+    A->h_shallow = false ;
+    return (GrB_SUCCESS) ;
+}
+
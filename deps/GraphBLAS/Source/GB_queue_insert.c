@@ -9,7 +9,9 @@
 
 // check if the matrix has pending computations (either pending tuples or
 // zombies, or both).  If it has any, and if it is not already in the queue,
-// then insert it into the queue.
+// then insert it into the queue.  Once in the queue, the matrix stays there
+// until its content is freed or GrB_wait removes it, even if its pending work
+// is finished in the meantime, so only the first insertion takes the lock.
 
 #include "GB.h"
 
@@ -26,39 +28,31 @@ bool GB_queue_insert            // insert matrix at the head of queue
     ASSERT (A != NULL) ;
 
     //--------------------------------------------------------------------------
-    // insert the matrix at the head of the queue
+    // insert the matrix at the head of its shard of the queue
     //--------------------------------------------------------------------------
 
-    bool ok = true ;
-
     if ((A->Pending != NULL || A->nzombies > 0) && !(A->enqueued))
-    { 
+    {
         // A is not in the queue yet, but needs to be there
-
-        // define the work to do inside the critical section
-        #define GB_CRITICAL_SECTION                                         \
-        {                                                                   \
-            /* check again to be safe, then add A to the head of queue */   \
-            if ((A->Pending != NULL || A->nzombies > 0) && !(A->enqueued))  \
-            {                                                               \
-                /* add the matrix to the head of the queue */               \
-                GrB_Matrix Head = (GrB_Matrix) (GB_Global_queue_head_get ( )) ;\
-                A->queue_next = Head ;                                      \
-                A->queue_prev = NULL ;                                      \
-                A->enqueued = true ;                                        \
-                if (Head != NULL)                                           \
-                {                                                           \
-                    Head->queue_prev = A ;                                  \
-                }                                                           \
-                GB_Global_queue_head_set (A) ;                              \
-            }                                                               \
+        int shard = GB_QUEUE_SHARD (A) ;
+        GB_Global_queue_lock (shard) ;
+
+        // check again to be safe, then add A to the head of its shard
+        if (!(A->enqueued))
+        { 
+            GrB_Matrix Head = (GrB_Matrix) (GB_Global_queue_head_get (shard)) ;
+            A->queue_next = Head ;
+            A->queue_prev = NULL ;
+            A->enqueued = true ;
+            if (Head != NULL)
+            { 
+                Head->queue_prev = A ;
+            }
+            GB_Global_queue_head_set (shard, A) ;
         }
 
-        // do the critical section, depending on user threading model
-        #include "GB_critical_section.c"
-
+        GB_Global_queue_unlock (shard) ;
     }
 
-    return (ok) ;
+    return (true) ;
 }
-
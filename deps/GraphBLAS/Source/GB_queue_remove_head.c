@@ -7,6 +7,9 @@
 
 //------------------------------------------------------------------------------
 
+// Removes the matrix at the head of the first non-empty shard of the queue,
+// or returns NULL if all shards are empty.
+
 #include "GB.h"
 
 bool GB_queue_remove_head       // remove matrix at the head of queue
@@ -22,43 +25,45 @@ bool GB_queue_remove_head       // remove matrix at the head of queue
     ASSERT (Ahandle != NULL) ;
 
     //--------------------------------------------------------------------------
-    // remove the matrix at the head the queue
+    // remove the matrix at the head of the first non-empty shard
     //--------------------------------------------------------------------------
 
     GrB_Matrix A = NULL ;
-    bool ok = true ;
-
-    // define the work to do inside the critical section
-    #define GB_CRITICAL_SECTION                                             \
-    {                                                                       \
-        /* get the matrix at the head of the queue */                       \
-        A = (GrB_Matrix) (GB_Global_queue_head_get ( )) ;                   \
-        /* remove A from the queue, if it exists */                         \
-        if (A != NULL)                                                      \
-        {                                                                   \
-            ASSERT (A->enqueued) ;                                          \
-            ASSERT (A->queue_prev == NULL) ;                                \
-            /* shift the head to the next matrix in the queue */            \
-            GrB_Matrix Next = (GrB_Matrix) A->queue_next ;                  \
-            GB_Global_queue_head_set (Next) ;                               \
-            if (Next != NULL)                                               \
-            {                                                               \
-                Next->queue_prev = NULL ;                                   \
-            }                                                               \
-            /* A has been removed from the queue */                         \
-            A->queue_next = NULL ;                                          \
-            A->enqueued = false ;                                           \
-        }                                                                   \
-    }
 
-    // do the critical section, depending on user threading model
-    #include "GB_critical_section.c"
+    for (int shard = 0 ; shard < GB_QUEUE_NSHARDS && A == NULL ; shard++)
+    {
+        // skip empty shards without taking their lock
+        if (GB_Global_queue_head_get (shard) == NULL) continue ;
+
+        GB_Global_queue_lock (shard) ;
+
+        // get the matrix at the head of the shard
+        A = (GrB_Matrix) (GB_Global_queue_head_get (shard)) ;
+
+        // remove A from the queue, if it exists
+        if (A != NULL)
+        { 
+            ASSERT (A->enqueued) ;
+            ASSERT (A->queue_prev == NULL) ;
+            // shift the head to the next matrix in the shard
+            GrB_Matrix Next = (GrB_Matrix) A->queue_next ;
+            GB_Global_queue_head_set (shard, Next) ;
+            if (Next != NULL)
+            { 
+                Next->queue_prev = NULL ;
+            }
+            // A has been removed from the queue
+            A->queue_next = NULL ;
+            A->enqueued = false ;
+        }
+
+        GB_Global_queue_unlock (shard) ;
+    }
 
     //--------------------------------------------------------------------------
     // return the matrix that was just removed from the head the queue
     //--------------------------------------------------------------------------
 
     (*Ahandle) = A ;
-    return (ok) ;
+    return (true) ;
 }
-
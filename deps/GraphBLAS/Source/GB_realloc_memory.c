@@ -83,6 +83,48 @@ void *GB_realloc_memory     // pointer to reallocated block of memory, or
         // the object does not change; do nothing
         (*ok1) = true ;
     }
+    else if (nitems_new < nitems_old && GB_hugepage_owns (p))
+    { 
+        // The object is on transparent huge pages, which realloc_function
+        // does not preserve.  Moving a large array to shrink it would copy
+        // it and briefly double its space, so it is kept in place instead,
+        // with its unused tail still allocated.  Only the new size is
+        // counted as in use.
+        (*ok1) = true ;
+        GB_Global_memory_update (-(int64_t)
+            ((nitems_old - nitems_new) * size_of_item)) ;
+        if (GB_Global_malloc_tracking_get ( ))
+        { 
+            #define GB_CRITICAL_SECTION                                      \
+            {                                                                \
+                GB_Global_inuse_decrement ((nitems_old - nitems_new)         \
+                    * size_of_item) ;                                        \
+            }
+            #include "GB_critical_section.c"
+        }
+    }
+    else if (nitems_new > nitems_old && (GB_hugepage_owns (p) ||
+        (GB_Global_hugepage_threshold_get ( ) > 0
+        && size >= GB_Global_hugepage_threshold_get ( ))))
+    {
+        // The old or new object is on transparent huge pages, which
+        // realloc_function does not preserve.  Allocate a new object, copy
+        // the old content, and free the old object.
+        void *pnew ;
+        GB_MALLOC_MEMORY (pnew, nitems_new, size_of_item) ;
+        if (pnew != NULL)
+        { 
+            memcpy (pnew, p, nitems_old * size_of_item) ;
+            GB_FREE_MEMORY (p, nitems_old, size_of_item) ;
+            p = pnew ;
+            (*ok1) = true ;
+        }
+        else
+        { 
+            // out of memory
+            (*ok1) = false ;
+        }
+    }
     else
     { 
         // change the size of the object from nitems_old to nitems_new
@@ -163,6 +205,8 @@ void *GB_realloc_memory     // pointer to reallocated block of memory, or
                 // the attempt to reduce the size of the block failed, but
                 // the old block is unchanged.  So pretend to succeed.
                 (*ok1) = true ;
+                GB_Global_memory_update (-(int64_t)
+                    ((nitems_old - nitems_new) * size_of_item)) ;
                 if (malloc_tracking)
                 { 
                     // reduce the amount of memory in use
@@ -186,6 +230,14 @@ void *GB_realloc_memory     // pointer to reallocated block of memory, or
             // success
             p = pnew ;
             (*ok1) = true ;
+            GB_Global_memory_update ((int64_t) (nitems_new * size_of_item)
+                - (int64_t) (nitems_old * size_of_item)) ;
+            if (nitems_new > nitems_old && GB_Global_stats_get ( ))
+            { 
+                // count the growth of the block as newly allocated
+                GB_Global_stats_bytes_increment ((int64_t)
+                    ((nitems_new - nitems_old) * size_of_item)) ;
+            }
             if (malloc_tracking)
             {
                 if (nitems_new < nitems_old)
@@ -64,7 +64,23 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     // delete any lingering zombies and assemble any pending tuples
     //--------------------------------------------------------------------------
 
-    GB_WAIT (A) ;
+    // start recording the telemetry of this operation (see GB_stats.c)
+    GB_Stats_mark stats ;
+    GB_stats_begin (&stats, A, NULL, NULL, Context) ;
+    GB_TRACE_BEGIN ("GrB_reduce") ;
+
+    // a view is reduced as-is, with no copy.  This is GB_WAIT_KEEP_VIEW,
+    // except that the trace is ended if it fails.
+    if (GB_PENDING_OR_ZOMBIES (A))
+    { 
+        info = GB_wait ((GrB_Matrix) A, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_TRACE_END ("GrB_reduce") ;
+            return (info) ;
+        }
+    }
     ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
 
     //--------------------------------------------------------------------------
@@ -84,6 +100,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     int ntasks = (nthreads == 1) ? 1 : (64 * nthreads) ;
     ntasks = GB_IMIN (ntasks, anz) ;
     ntasks = GB_IMAX (ntasks, 1) ;
+    GB_STATS_KERNEL (GxB_DEFAULT, nthreads, ntasks, anz) ;
 
     //--------------------------------------------------------------------------
     // s = reduce_to_scalar (A)
@@ -295,6 +312,8 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
         cast_zaccum_to_C (c, zaccum, ctype->size) ;
     }
 
+    GB_TRACE_END ("GrB_reduce") ;
+    GB_stats_end (&stats, GxB_STATS_REDUCE, NULL, Context) ;
     return (GrB_SUCCESS) ;
 }
 
@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+// GB_rsort_3: sort (j,i,k) tuples with a parallel LSD radix sort
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Sorts a list of (j,i,k) tuples, where 0 <= i < 2^ibits, 0 <= j < 2^jbits,
+// and ibits + jbits <= 64.  The list is sorted in the same order as
+// GB_msort_3, if the k part is initially K [p] = p for each tuple.  If J is
+// NULL, the list of (i,k) tuples is sorted instead (as in GB_msort_2), and
+// jbits must be zero.
+
+// The pair (j,i) is packed into a single unsigned 64-bit key (j << ibits | i),
+// and the keys are sorted with a least-significant-digit radix sort, with
+// 8-bit digits.  Each pass is stable, so tuples with equal keys stay in
+// ascending order of k.  The only passes done are those needed for the
+// ibits+jbits bits of the key, and a pass is skipped if all keys have the same
+// digit.  Each pass makes two sequential sweeps of the list, in parallel: one
+// to count the digits in each slice of the list, and one to move the tuples.
+
+// The keys are held in J and I during the sort (or in I and W_1, if J is
+// NULL), and W_0 is workspace for the k part of each tuple.  The result is
+// unpacked back into J, I, and K.
+
+#include "GB_sort.h"
+
+// # of bits in each digit of the key, and the # of distinct digits
+#define GB_RSORT_BITS 8
+#define GB_RSORT_DIGITS (1 << GB_RSORT_BITS)
+
+// max # of tasks; each task uses GB_RSORT_DIGITS counts on the stack
+#define GB_RSORT_MAXTASKS 64
+
+void GB_rsort_3     // sort (j,i,k) tuples with a radix sort on (j,i)
+(
+    int64_t *J,                 // size n array, or NULL
+    int64_t *I,                 // size n array
+    int64_t *K,                 // size n array
+    int64_t *restrict W_0,      // size n array, workspace
+    int64_t *restrict W_1,      // size n array, workspace if J is NULL
+    const int64_t n,
+    const int ibits,            // 0 <= I [p] < 2^ibits
+    const int jbits,            // 0 <= J [p] < 2^jbits (zero if J is NULL)
+    const int nthreads          // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (ibits >= 0 && jbits >= 0 && ibits + jbits <= 64) ;
+    ASSERT (GB_IMPLIES (J == NULL, jbits == 0 && W_1 != NULL)) ;
+    ASSERT (GB_IMPLIES (J != NULL, jbits > 0 && ibits < 64)) ;
+    if (n <= 1) return ;
+
+    int ntasks = GB_IMIN (nthreads, GB_RSORT_MAXTASKS) ;
+    ntasks = (int) GB_IMIN (ntasks, n) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    //--------------------------------------------------------------------------
+    // pack the keys
+    //--------------------------------------------------------------------------
+
+    // Key and Kwork hold the current list, and Key2 and Kwork2 receive the
+    // list after each pass.  If J is present, the packed key replaces J [p]
+    // and I is used as workspace for the keys.  Otherwise, the key is just
+    // I [p], and W_1 is used as workspace for the keys.
+
+    // These pointers alias J, I, and K, so they are not declared restrict.
+    uint64_t *Key  = (uint64_t *) ((J == NULL) ? I : J) ;
+    uint64_t *Key2 = (uint64_t *) ((J == NULL) ? W_1 : I) ;
+    int64_t *Kwork  = K ;
+    int64_t *Kwork2 = W_0 ;
+
+    if (J != NULL)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (int64_t p = 0 ; p < n ; p++)
+        { 
+            Key [p] = (((uint64_t) J [p]) << ibits) | ((uint64_t) I [p]) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the keys, one digit at a time
+    //--------------------------------------------------------------------------
+
+    int64_t Count [ntasks * GB_RSORT_DIGITS] ;
+    int nbits = ibits + jbits ;
+
+    for (int shift = 0 ; shift < nbits ; shift += GB_RSORT_BITS)
+    {
+
+        //----------------------------------------------------------------------
+        // count the digits in each slice of the list
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(ntasks) schedule(static)
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t *restrict C = Count + tid * GB_RSORT_DIGITS ;
+            for (int d = 0 ; d < GB_RSORT_DIGITS ; d++)
+            { 
+                C [d] = 0 ;
+            }
+            int64_t pstart, pend ;
+            GB_PARTITION (pstart, pend, n, tid, ntasks) ;
+            for (int64_t p = pstart ; p < pend ; p++)
+            { 
+                C [(Key [p] >> shift) & (GB_RSORT_DIGITS-1)]++ ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // find where each slice places its tuples with each digit
+        //----------------------------------------------------------------------
+
+        int64_t s = 0 ;
+        bool skip = false ;
+        for (int d = 0 ; d < GB_RSORT_DIGITS ; d++)
+        {
+            int64_t s_start = s ;
+            for (int tid = 0 ; tid < ntasks ; tid++)
+            { 
+                int64_t c = Count [tid * GB_RSORT_DIGITS + d] ;
+                Count [tid * GB_RSORT_DIGITS + d] = s ;
+                s += c ;
+            }
+            // if all the keys have the same digit d, this pass does nothing
+            if (s - s_start == n) skip = true ;
+        }
+        if (skip) continue ;
+
+        //----------------------------------------------------------------------
+        // move each tuple to its place in the next list
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(ntasks) schedule(static)
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t *restrict C = Count + tid * GB_RSORT_DIGITS ;
+            int64_t pstart, pend ;
+            GB_PARTITION (pstart, pend, n, tid, ntasks) ;
+            for (int64_t p = pstart ; p < pend ; p++)
+            { 
+                uint64_t key = Key [p] ;
+                int64_t q = C [(key >> shift) & (GB_RSORT_DIGITS-1)]++ ;
+                Key2 [q] = key ;
+                Kwork2 [q] = Kwork [p] ;
+            }
+        }
+
+        // the next list becomes the current list
+        uint64_t *Key_swap = Key ; Key = Key2 ; Key2 = Key_swap ;
+        int64_t *Kwork_swap = Kwork ; Kwork = Kwork2 ; Kwork2 = Kwork_swap ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack the result into J, I, and K
+    //--------------------------------------------------------------------------
+
+    if (J != NULL)
+    {
+        // Key is either J or I; each key is read before J [p] and I [p] are
+        // overwritten
+        uint64_t imask = (((uint64_t) 1) << ibits) - 1 ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (int64_t p = 0 ; p < n ; p++)
+        { 
+            uint64_t key = Key [p] ;
+            J [p] = (int64_t) (key >> ibits) ;
+            I [p] = (int64_t) (key & imask) ;
+        }
+    }
+    else if (Key != (uint64_t *) I)
+    { 
+        // the sorted keys are in W_1
+        GB_memcpy (I, Key, n * sizeof (int64_t), nthreads) ;
+    }
+
+    if (Kwork != K)
+    { 
+        // the sorted k part of each tuple is in W_0
+        GB_memcpy (K, Kwork, n * sizeof (int64_t), nthreads) ;
+    }
+}
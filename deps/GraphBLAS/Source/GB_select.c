@@ -12,6 +12,7 @@
 #define GB_FREE_ALL                         \
 {                                           \
     GB_MATRIX_FREE (&T) ;                   \
+    GB_TRACE_END ("GxB_select") ;           \
 }
 
 #include "GB_select.h"
@@ -23,6 +24,7 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     const bool C_replace,           // C descriptor
     const GrB_Matrix M,             // optional mask for C, unused if NULL
     const bool Mask_comp,           // descriptor for M
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
     const GxB_SelectOp op,          // operator to select the entries
     const GrB_Matrix A,             // input matrix
@@ -52,8 +54,11 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     GrB_Matrix T = NULL ;
 
     // check domains and dimensions for C<M> = accum (C,T)
-    GrB_Info info ;
-    GB_OK (GB_compatible (C->type, C, M, accum, A->type, Context)) ;
+    GrB_Info info = GB_compatible (C->type, C, M, accum, A->type, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (info) ;
+    }
 
     GB_Type_code typecode = A->type->code ;
     GB_Select_Opcode opcode = op->opcode ;
@@ -193,13 +198,25 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp) ;
 
+    // start recording the telemetry of this operation (see GB_stats.c)
+    GB_Stats_mark stats ;
+    GB_stats_begin (&stats, A, NULL, M, Context) ;
+    GB_TRACE_BEGIN ("GxB_select") ;
+
     //--------------------------------------------------------------------------
     // delete any lingering zombies and assemble any pending tuples
     //--------------------------------------------------------------------------
 
+    // This is GB_WAIT, except that the trace is ended if it fails.
     // GB_WAIT (C) ;
-    GB_WAIT (M) ;
-    GB_WAIT (A) ;
+    if (GB_PENDING_OR_ZOMBIES (M) || GB_IS_VIEW (M))
+    { 
+        GB_OK (GB_wait ((GrB_Matrix) M, Context)) ;
+    }
+    if (GB_PENDING_OR_ZOMBIES (A) || GB_IS_VIEW (A))
+    { 
+        GB_OK (GB_wait ((GrB_Matrix) A, Context)) ;
+    }
 
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format and the transposed case
@@ -485,6 +502,13 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     // C<M> = accum (C,T): accumulate the results into C via the mask
     //--------------------------------------------------------------------------
 
-    return (GB_ACCUM_MASK (C, M, NULL, accum, &T, C_replace, Mask_comp)) ;
+    info = GB_ACCUM_MASK (C, M, NULL, accum, &T, C_replace, Mask_comp,
+        Mask_struct) ;
+    GB_TRACE_END ("GxB_select") ;
+    if (info == GrB_SUCCESS)
+    { 
+        GB_stats_end (&stats, GxB_STATS_SELECT, C, Context) ;
+    }
+    return (info) ;
 }
 
@@ -17,6 +17,7 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     const bool C_replace,           // C descriptor
     const GrB_Matrix M,             // optional mask for C, unused if NULL
     const bool Mask_comp,           // descriptor for M
+    const bool Mask_struct,         // if true, use only the pattern of M
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
     const GxB_SelectOp op,          // operator to select the entries
     const GrB_Matrix A,             // input matrix
@@ -37,6 +38,24 @@ GrB_Info GB_selector
     GB_Context Context
 ) ;
 
+GrB_Info GB_split_tri       // split A into three parts, in a single pass
+(
+    GrB_Matrix *T0handle,   // entries A(i,j) with i < j, not computed if NULL
+    GrB_Matrix *T1handle,   // entries A(i,j) with i == j, not computed if NULL
+    GrB_Matrix *T2handle,   // entries A(i,j) with i > j, not computed if NULL
+    const GrB_Matrix A,     // input matrix
+    GB_Context Context
+) ;
+
+GrB_Info GB_tri_view        // view the entries of A on one side of its diagonal
+(
+    GrB_Matrix *Vhandle,    // output view
+    const bool before,      // if true, view the entries A(i,j) with i < j,
+                            // otherwise view the entries with i > j
+    const GrB_Matrix A,     // input matrix
+    GB_Context Context
+) ;
+
 //------------------------------------------------------------------------------
 // GB_is_nonzero
 //------------------------------------------------------------------------------
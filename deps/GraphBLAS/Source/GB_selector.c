@@ -74,6 +74,7 @@ GrB_Info GB_selector
     int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
     ntasks = GB_IMIN (ntasks, anz) ;
     ntasks = GB_IMAX (ntasks, 1) ;
+    GB_STATS_KERNEL (GxB_DEFAULT, nthreads, ntasks, anz) ;
 
     //--------------------------------------------------------------------------
     // get A
@@ -191,7 +192,7 @@ GrB_Info GB_selector
     if (opcode <= GB_RESIZE_opcode)
     {
         // allocate Zp
-        GB_MALLOC_MEMORY (Zp, aplen, sizeof (int64_t)) ;
+        GB_ARENA_MALLOC (Zp, aplen, sizeof (int64_t)) ;
         if (Zp == NULL)
         { 
             // out of memory
@@ -214,7 +215,9 @@ GrB_Info GB_selector
     }                                                                   \
     break ;
 
+    GB_TRACE_BEGIN ("select phase1") ;
     #include "GB_select_factory.c"
+    GB_TRACE_END ("select phase1") ;
 
     #undef  GB_SELECT_PHASE1
     #undef  GB_SEL_WORKER
@@ -289,6 +292,9 @@ GrB_Info GB_selector
         return (GB_OUT_OF_MEMORY) ;
     }
 
+    GB_numa_place (Ci, cnz * sizeof (int64_t), nthreads) ;
+    GB_numa_place (Cx, cnz * asize, nthreads) ;
+
     //--------------------------------------------------------------------------
     // phase2: launch the switch factory to select the entries
     //--------------------------------------------------------------------------
@@ -304,7 +310,9 @@ GrB_Info GB_selector
     }                                                                   \
     break ;
 
+    GB_TRACE_BEGIN ("select phase2") ;
     #include "GB_select_factory.c"
+    GB_TRACE_END ("select phase2") ;
 
     //--------------------------------------------------------------------------
     // create the result
@@ -319,7 +327,11 @@ GrB_Info GB_selector
 
         if (A->is_hyper && C_nvec_nonempty < anvec)
         {
-            // prune empty vectors from Ah and Ap
+            // prune empty vectors from Ah and Ap, in place.  Ap and Ah may be
+            // shallow (see GB_AxB_dot3), so they are made private first.
+            GB_OK (GB_ph_unshare (A, Context)) ;
+            Ap = A->p ;
+            Ah = A->h ;
             // printf ("prune empties\n") ;
             int64_t cnvec = 0 ;
             for (int64_t k = 0 ; k < anvec ; k++)
@@ -339,8 +351,10 @@ GrB_Info GB_selector
         }
         else
         { 
-            GB_FREE_MEMORY (Ap, aplen+1, sizeof (int64_t)) ;
+            // free the old Ap, unless it is shallow; Ah is left unchanged
+            if (!A->p_shallow) GB_FREE_MEMORY (Ap, aplen+1, sizeof (int64_t)) ;
             A->p = Cp ; Cp = NULL ;
+            A->p_shallow = false ;
         }
 
         ASSERT (Cp == NULL) ;
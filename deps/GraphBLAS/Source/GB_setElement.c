@@ -75,6 +75,9 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     // pending tuples and zombies are expected
     ASSERT (GB_PENDING_OK (C)) ; ASSERT (GB_ZOMBIES_OK (C)) ;
 
+    // a view cannot be modified in place, so it is copied first
+    if (GB_IS_VIEW (C)) GB_WAIT_MATRIX (C) ;
+
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format
     //--------------------------------------------------------------------------
@@ -151,13 +154,9 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
             // bring the zombie back to life
             ASSERT (C->enqueued) ;
             C->i [pleft] = i ;
+            // C stays in the queue even if it has no more zombies or
+            // pending tuples
             C->nzombies-- ;
-            if (C->nzombies == 0 && C->Pending == NULL)
-            { 
-                // remove from queue if no zombies or pending tuples
-                // FUTURE:: may thrash; see GrB_wait.
-                GB_CRITICAL (GB_queue_remove (C)) ;
-            }
         }
 
         // the check is fine but just costly even when debugging
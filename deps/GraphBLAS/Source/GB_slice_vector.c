@@ -33,8 +33,11 @@
 // NULL.  In this case, Ai is NULL, and represents the implicit list
 // A_hfirst:A_hfirst+pA_end-1, inclusive.
 
+// The explicit list Ai can contain zombies, if A_nzombies > 0.  This occurs
+// only when GB_wait merges pending tuples into a matrix with zombies.
+
 // This macro defines the kth entry in the Ai list, for k = 0 to pA_end-1:
-#define GB_Ai(k) ((Ai != NULL) ? Ai [k] : (A_hfirst + (k)))
+#define GB_Ai(k) ((Ai != NULL) ? GB_UNFLIP (Ai [k]) : (A_hfirst + (k)))
 
 // If n = A->vlen = B->vlen, anz = nnz (A (:,kA)), and bnz = nnz (B (:,kB)),
 // then the total time taken by this function is O(log(n)*(log(anz)+log(bnz))),
@@ -57,6 +60,7 @@ void GB_slice_vector
     const int64_t pA_end,           // A(:,kA) ends at pA_end-1 in Ai,Ax
     const int64_t *restrict Ai,     // indices of A
     const int64_t A_hfirst,         // if Ai is an implicit hyperlist
+    const int64_t A_nzombies,       // # of zombies in Ai (GB_add for GB_wait)
     const int64_t pB_start,         // B(:,kB) starts at pB_start in Bi,Bx
     const int64_t pB_end,           // B(:,kB) ends at pB_end-1 in Bi,Bx
     const int64_t *restrict Bi,     // indices of B
@@ -149,9 +153,10 @@ void GB_slice_vector
             // Ai is an explicit integer list, Ai [pA_start:pA_end-1]
             ASSERT (aknz > 0) ;
             pA = pA_start ;
-            bool afound ;
+            bool afound, is_zombie ;
             int64_t apright = pA_end - 1 ;
-            GB_BINARY_SPLIT_SEARCH (i, Ai, pA, apright, afound) ;
+            GB_BINARY_SPLIT_ZOMBIE (i, Ai, pA, apright, afound, A_nzombies,
+                is_zombie) ;
             ASSERT (GB_IMPLIES (afound, GB_Ai (pA) == i)) ;
             ASSERT (pA_start <= pA && pA <= pA_end) ;
         }
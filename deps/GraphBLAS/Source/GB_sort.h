@@ -8,9 +8,9 @@
 //------------------------------------------------------------------------------
 
 // All of the GB_qsort_* functions are single-threaded, by design.  Both
-// GB_msort_* functions are parallel.  None of these sorting methods are
-// guaranteed to be stable, but they are always used in GraphBLAS with unique
-// keys.
+// GB_msort_* functions are parallel, as is the radix sort GB_rsort_3.  None
+// of these sorting methods are guaranteed to be stable, but they are always
+// used in GraphBLAS with unique keys.
 
 #ifndef GB_SORT_H
 #define GB_SORT_H
@@ -69,6 +69,33 @@ void GB_msort_3     // sort array A of size 3-by-n, using 3 keys (A [0:2][])
     const int nthreads          // # of threads to use
 ) ;
 
+void GB_rsort_3     // sort (j,i,k) tuples with a radix sort on (j,i)
+(
+    int64_t *J,                 // size n array, or NULL
+    int64_t *I,                 // size n array
+    int64_t *K,                 // size n array
+    int64_t *restrict W_0,      // size n array, workspace
+    int64_t *restrict W_1,      // size n array, workspace if J is NULL
+    const int64_t n,
+    const int ibits,            // 0 <= I [p] < 2^ibits
+    const int jbits,            // 0 <= J [p] < 2^jbits (zero if J is NULL)
+    const int nthreads          // # of threads to use
+) ;
+
+// GB_rsort_nbits: # of bits needed to hold the indices 0 to n-1
+static inline int GB_rsort_nbits (int64_t n)
+{
+    int nbits = 0 ;
+    while (nbits < 63 && (((int64_t) 1) << nbits) < n)
+    { 
+        nbits++ ;
+    }
+    return (nbits) ;
+}
+
+// GB_rsort_3 is used only for lists of at least this many tuples
+#define GB_RSORT_MIN 4096
+
 //------------------------------------------------------------------------------
 // GB_lt_1: sorting comparator function, one key
 //------------------------------------------------------------------------------
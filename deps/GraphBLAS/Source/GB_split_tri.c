@@ -0,0 +1,287 @@
+//------------------------------------------------------------------------------
+// GB_split_tri: split a matrix into its strict lower, diagonal, and upper parts
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The entries of each vector A(:,j) are partitioned into three parts, in terms
+// of the indices i and j of the data structure (not the rows and columns):
+// T0 holds the entries with i < j, T1 the entry with i == j, and T2 the
+// entries with i > j.  The caller decides which of these are the lower and
+// upper triangular parts, depending on the CSR/CSC format of A.  Any of the
+// three outputs can be skipped by passing a NULL handle.
+
+// The indices in each vector are sorted, so each part is a contiguous range of
+// A(:,j).  The ranges are found by a binary search for the diagonal, in each
+// vector, and then all the entries of A are copied into the outputs in a
+// single parallel sweep.  This takes half the memory traffic of two calls to
+// GB_selector, one for tril and one for triu, which each read all of A.
+
+// A must not have any pending tuples or zombies.  Each output is a new matrix
+// of the same type and hypersparsity as A, with is_csc true; the caller must
+// set its format.
+
+#include "GB_select.h"
+
+#define GB_FREE_WORK                                                    \
+{                                                                       \
+    GB_FREE_MEMORY (Zd, aplen, sizeof (int64_t)) ;                      \
+    for (int t = 0 ; t < 3 ; t++)                                       \
+    {                                                                   \
+        GB_FREE_MEMORY (Tp [t], aplen+1, sizeof (int64_t)) ;            \
+        GB_FREE_MEMORY (Th [t], aplen,   sizeof (int64_t)) ;            \
+        GB_FREE_MEMORY (Ti [t], tnz [t], sizeof (int64_t)) ;            \
+        GB_FREE_MEMORY (Tx [t], tnz [t], asize) ;                       \
+    }                                                                   \
+}
+
+#define GB_FREE_ALL                                                     \
+{                                                                       \
+    GB_FREE_WORK ;                                                      \
+    for (int t = 0 ; t < 3 ; t++)                                       \
+    {                                                                   \
+        if (Thandle [t] != NULL) GB_MATRIX_FREE (Thandle [t]) ;         \
+    }                                                                   \
+}
+
+GrB_Info GB_split_tri       // split A into three parts, in a single pass
+(
+    GrB_Matrix *T0handle,   // entries A(i,j) with i < j, not computed if NULL
+    GrB_Matrix *T1handle,   // entries A(i,j) with i == j, not computed if NULL
+    GrB_Matrix *T2handle,   // entries A(i,j) with i > j, not computed if NULL
+    const GrB_Matrix A,     // input matrix
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_OK (GB_check (A, "A input for GB_split_tri", GB0)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+
+    GrB_Matrix *Thandle [3] = { T0handle, T1handle, T2handle } ;
+    for (int t = 0 ; t < 3 ; t++)
+    {
+        if (Thandle [t] != NULL) (*(Thandle [t])) = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_void *restrict Ax = A->x ;
+    int64_t asize = A->type->size ;
+    int64_t aplen = A->plen ;
+    int64_t anvec = A->nvec ;
+    int64_t anz = GB_NNZ (A) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz + anvec, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the vector pointers of each output, and workspace
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Zd = NULL ;
+    int64_t *restrict Tp [3] = { NULL, NULL, NULL } ;
+    int64_t *restrict Th [3] = { NULL, NULL, NULL } ;
+    int64_t *restrict Ti [3] = { NULL, NULL, NULL } ;
+    GB_void *restrict Tx [3] = { NULL, NULL, NULL } ;
+    int64_t tnz [3] = { 0, 0, 0 } ;
+    int64_t tnvec_nonempty [3] = { 0, 0, 0 } ;
+
+    // Zd [k] is the position of the first entry in A(:,j) with i >= j
+    GB_ARENA_MALLOC (Zd, aplen, sizeof (int64_t)) ;
+    bool ok = (Zd != NULL) ;
+    for (int t = 0 ; t < 3 ; t++)
+    {
+        if (Thandle [t] != NULL)
+        {
+            GB_MALLOC_MEMORY (Tp [t], aplen+1, sizeof (int64_t)) ;
+            ok = ok && (Tp [t] != NULL) ;
+        }
+    }
+    if (!ok)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t *restrict T0p = Tp [0] ;
+    int64_t *restrict T1p = Tp [1] ;
+    int64_t *restrict T2p = Tp [2] ;
+
+    //--------------------------------------------------------------------------
+    // phase1: find the diagonal in each vector, and count each part
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int64_t k = 0 ; k < anvec ; k++)
+    {
+        int64_t j = (Ah == NULL) ? k : Ah [k] ;
+        int64_t pA_start = Ap [k] ;
+        int64_t pA_end = Ap [k+1] ;
+        int64_t pleft = pA_start ;
+        int64_t pright = pA_end - 1 ;
+        bool found ;
+        GB_BINARY_SPLIT_SEARCH (j, Ai, pleft, pright, found) ;
+        // A(pA_start:pleft-1,j) is above the diagonal, A(pleft,j) is the
+        // diagonal if found, and the rest of A(:,j) is below it
+        Zd [k] = pleft ;
+        int64_t ndiag = found ? 1 : 0 ;
+        if (T0p != NULL) T0p [k] = pleft - pA_start ;
+        if (T1p != NULL) T1p [k] = ndiag ;
+        if (T2p != NULL) T2p [k] = pA_end - pleft - ndiag ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the vector pointers of each output, and allocate its content
+    //--------------------------------------------------------------------------
+
+    for (int t = 0 ; t < 3 ; t++)
+    {
+        if (Tp [t] == NULL) continue ;
+        GB_cumsum (Tp [t], anvec, &(tnvec_nonempty [t]), nthreads) ;
+        tnz [t] = Tp [t][anvec] ;
+        GB_MALLOC_MEMORY (Ti [t], tnz [t], sizeof (int64_t)) ;
+        GB_MALLOC_MEMORY (Tx [t], tnz [t], asize) ;
+        if (Ti [t] == NULL || Tx [t] == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GB_OUT_OF_MEMORY) ;
+        }
+        GB_numa_place (Ti [t], tnz [t] * sizeof (int64_t), nthreads) ;
+        GB_numa_place (Tx [t], tnz [t] * asize, nthreads) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // phase2: copy each part of each vector into its output
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict T0i = Ti [0] ;
+    int64_t *restrict T1i = Ti [1] ;
+    int64_t *restrict T2i = Ti [2] ;
+    GB_void *restrict T0x = Tx [0] ;
+    GB_void *restrict T1x = Tx [1] ;
+    GB_void *restrict T2x = Tx [2] ;
+
+    // vectors can have very different lengths, so they are scheduled
+    // dynamically
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,64)
+    for (int64_t k = 0 ; k < anvec ; k++)
+    {
+        int64_t j = (Ah == NULL) ? k : Ah [k] ;
+        int64_t pA = Ap [k] ;
+        int64_t pdiag = Zd [k] ;
+        int64_t pA_end = Ap [k+1] ;
+        int64_t n0 = pdiag - pA ;
+        if (T0p != NULL && n0 > 0)
+        {
+            int64_t pT = T0p [k] ;
+            memcpy (T0i + pT, Ai + pA, n0 * sizeof (int64_t)) ;
+            memcpy (T0x + pT * asize, Ax + pA * asize, n0 * asize) ;
+        }
+        pA = pdiag ;
+        int64_t n1 = (pA < pA_end && Ai [pA] == j) ? 1 : 0 ;
+        if (T1p != NULL && n1 > 0)
+        {
+            int64_t pT = T1p [k] ;
+            T1i [pT] = Ai [pA] ;
+            memcpy (T1x + pT * asize, Ax + pA * asize, asize) ;
+        }
+        pA += n1 ;
+        int64_t n2 = pA_end - pA ;
+        if (T2p != NULL && n2 > 0)
+        {
+            int64_t pT = T2p [k] ;
+            memcpy (T2i + pT, Ai + pA, n2 * sizeof (int64_t)) ;
+            memcpy (T2x + pT * asize, Ax + pA * asize, n2 * asize) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // create each output and transplant its content
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    for (int t = 0 ; t < 3 ; t++)
+    {
+        if (Thandle [t] == NULL) continue ;
+
+        GB_NEW (Thandle [t], A->type, A->vlen, A->vdim, GB_Ap_null, true,
+            GB_SAME_HYPER_AS (A->is_hyper), A->hyper_ratio, aplen, Context) ;
+        if (info != GrB_SUCCESS)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+        GrB_Matrix T = (*(Thandle [t])) ;
+        int64_t *restrict Tpt = Tp [t] ;
+
+        if (A->is_hyper)
+        {
+            GB_MALLOC_MEMORY (Th [t], aplen, sizeof (int64_t)) ;
+            if (Th [t] == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GB_OUT_OF_MEMORY) ;
+            }
+
+            // copy the non-empty vectors from Ah
+            int64_t *restrict Tht = Th [t] ;
+            int64_t tnvec = 0 ;
+            for (int64_t k = 0 ; k < anvec ; k++)
+            {
+                if (Tpt [k] < Tpt [k+1])
+                {
+                    Tht [tnvec] = Ah [k] ;
+                    Tpt [tnvec] = Tpt [k] ;
+                    tnvec++ ;
+                }
+            }
+            Tpt [tnvec] = Tpt [anvec] ;
+            T->nvec = tnvec ;
+            ASSERT (T->nvec == tnvec_nonempty [t]) ;
+        }
+
+        T->p = Tp [t] ; Tp [t] = NULL ;
+        T->h = Th [t] ; Th [t] = NULL ;
+        T->i = Ti [t] ; Ti [t] = NULL ;
+        T->x = Tx [t] ; Tx [t] = NULL ;
+        T->nzmax = tnz [t] ;
+        T->magic = GB_MAGIC ;
+        T->nvec_nonempty = tnvec_nonempty [t] ;
+
+        if (T->nzmax == 0)
+        {
+            GB_FREE_MEMORY (T->i, T->nzmax, sizeof (int64_t)) ;
+            GB_FREE_MEMORY (T->x, T->nzmax, asize) ;
+        }
+
+        ASSERT_OK (GB_check (T, "T output for GB_split_tri", GB0)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
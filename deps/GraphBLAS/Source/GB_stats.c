@@ -0,0 +1,135 @@
+//------------------------------------------------------------------------------
+// GB_stats: per-operation telemetry
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// If GxB_STATS is enabled, GB_mxm, GB_select, GB_reduce_to_scalar, GB_build
+// and GB_wait each append a GxB_Stats record to the log in GB_Global when
+// they succeed.  The wall-clock time and the # of bytes allocated are taken
+// here.  The kernel chosen, its # of threads and tasks, and its flop count
+// are left in the Context by the kernel itself, via GB_STATS_KERNEL.  The #
+// of entries of the inputs is taken when the operation starts, since the
+// result may be one of the inputs, and that of the result when it ends.
+
+// The # of bytes allocated is counted by all threads together, so an
+// operation also sees the allocations of any other user thread that is
+// calling GraphBLAS at the same time.
+
+// These functions are defined here:
+
+//      GB_stats_begin:     start recording an operation
+//      GB_stats_end:       append the record of a successful operation
+
+#include "GB.h"
+#include <time.h>
+
+static double GB_stats_time (void)
+{
+    #if defined ( _OPENMP )
+    return (omp_get_wtime ( )) ;
+    #else
+    return ((double) clock ( ) / (double) CLOCKS_PER_SEC) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_stats_nnz: # of live entries and pending tuples in a matrix or view
+//------------------------------------------------------------------------------
+
+static int64_t GB_stats_nnz (const GrB_Matrix A)
+{
+
+    if (A == NULL) return (0) ;
+    if (!GB_IS_VIEW (A)) return (GB_NNZ_UPPER_BOUND (A)) ;
+
+    // the entries of a view are a part of each vector of another matrix
+    int64_t anz = 0 ;
+    for (int64_t k = 0 ; k < A->nvec ; k++)
+    { 
+        anz += A->e [k] - A->p [k] ;
+    }
+    return (anz) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_stats_begin: start recording an operation
+//------------------------------------------------------------------------------
+
+void GB_stats_begin
+(
+    GB_Stats_mark *mark,        // mark to start
+    const GrB_Matrix A,         // inputs of the operation, each may be NULL
+    const GrB_Matrix B,
+    const GrB_Matrix M,         // mask of the operation, NULL if none
+    GB_Context Context
+)
+{
+
+    mark->on = GB_Global_stats_get ( ) ;
+    if (!mark->on) return ;
+
+    mark->anz = GB_stats_nnz (A) ;
+    mark->bnz = GB_stats_nnz (B) ;
+    mark->mnz = GB_stats_nnz (M) ;
+
+    // save the kernel telemetry of the enclosing operation, if any
+    if (Context != NULL)
+    { 
+        mark->method   = Context->stats_method ;
+        mark->nthreads = Context->stats_nthreads ;
+        mark->ntasks   = Context->stats_ntasks ;
+        mark->flops    = Context->stats_flops ;
+    }
+    GB_STATS_KERNEL (GxB_DEFAULT, 0, 0, 0) ;
+
+    mark->bytes = GB_Global_stats_bytes_get ( ) ;
+    mark->time  = GB_stats_time ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_stats_end: append the record of a successful operation
+//------------------------------------------------------------------------------
+
+void GB_stats_end
+(
+    GB_Stats_mark *mark,        // mark from GB_stats_begin
+    GxB_Stats_Op op,            // operation to record
+    const GrB_Matrix C,         // result of the operation, may be NULL
+    GB_Context Context
+)
+{
+
+    if (!mark->on) return ;
+
+    GxB_Stats record ;
+    record.op = op ;
+    record.time = GB_stats_time ( ) - mark->time ;
+    record.bytes = GB_Global_stats_bytes_get ( ) - mark->bytes ;
+    record.method = GxB_DEFAULT ;
+    record.nthreads = 0 ;
+    record.ntasks = 0 ;
+    record.flops = 0 ;
+    record.anz = mark->anz ;
+    record.bnz = mark->bnz ;
+    record.mnz = mark->mnz ;
+    record.cnz = GB_stats_nnz (C) ;
+
+    if (Context != NULL)
+    { 
+        record.method   = (GrB_Desc_Value) Context->stats_method ;
+        record.nthreads = Context->stats_nthreads ;
+        record.ntasks   = Context->stats_ntasks ;
+        record.flops    = Context->stats_flops ;
+        // restore the kernel telemetry of the enclosing operation
+        Context->stats_method   = mark->method ;
+        Context->stats_nthreads = mark->nthreads ;
+        Context->stats_ntasks   = mark->ntasks ;
+        Context->stats_flops    = mark->flops ;
+    }
+
+    GB_Global_stats_log_append (&record) ;
+}
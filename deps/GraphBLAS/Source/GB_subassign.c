@@ -22,12 +22,14 @@
 
 #include "GB_subassign.h"
 #include "GB_transpose.h"
+#include "GB_apply.h"
 
 #define GB_FREE_ALL                                 \
 {                                                   \
     GB_MATRIX_FREE (&Z2) ;                          \
     GB_MATRIX_FREE (&AT) ;                          \
     GB_MATRIX_FREE (&MT) ;                          \
+    GB_MATRIX_FREE (&MS) ;                          \
 }
 
 GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
@@ -36,6 +38,7 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
     const bool C_replace,           // descriptor for C
     const GrB_Matrix M_in,          // optional mask for C(Rows,Cols)
     const bool Mask_comp,           // true if mask is complemented
+    const bool Mask_struct,         // if true, use only the pattern of M
     bool M_transpose,               // true if the mask should be transposed
     const GrB_BinaryOp accum,       // optional accum for accum(C,T)
     const GrB_Matrix A_in,          // input matrix
@@ -92,6 +95,7 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
 
     GrB_Matrix AT = NULL ;
     GrB_Matrix MT = NULL ;
+    GrB_Matrix MS = NULL ;
     GrB_Matrix Z2 = NULL ;
     GrB_Matrix Z = NULL ;
 
@@ -179,13 +183,27 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
     // if C == M or C == A, pending updates are applied to C as well
 
     // delete any lingering zombies and assemble any pending tuples
-    // but only in A and M, not C
+    // but only in A and M, not C.  A view C is copied, since it cannot be
+    // modified in place.
+    if (GB_IS_VIEW (C)) GB_WAIT_MATRIX (C) ;
     GB_WAIT (M) ;
     if (!scalar_expansion)
     { 
         GB_WAIT (A) ;
     }
 
+    //--------------------------------------------------------------------------
+    // use only the pattern of M, if requested
+    //--------------------------------------------------------------------------
+
+    // GB_subassigner reads the values of the mask, so a structural mask is
+    // replaced with a boolean shallow copy of M, with all values true
+    if (Mask_struct && M != NULL)
+    { 
+        GB_OK (GB_shallow_op (&MS, M->is_csc, GxB_ONE_BOOL, M, Context)) ;
+        M = MS ;
+    }
+
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format of C:
     //--------------------------------------------------------------------------
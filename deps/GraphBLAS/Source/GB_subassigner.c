@@ -1036,26 +1036,13 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
     // insert C in the queue if it has work to do and isn't already queued
     //--------------------------------------------------------------------------
 
-    if (C->nzombies == 0 && C->Pending == NULL)
-    { 
-        // C may be in the queue from a prior assignment, but this assignemt
-        // can bring zombies back to life, and the zombie count can go to zero.
-        // In that case, C must be removed from the queue.  The removal does
-        // nothing if C is already not in the queue.
-
-        // FUTURE:: this might cause thrashing if lots of assigns or
-        // setElements are done in parallel.  Instead, leave the matrix in the
-        // queue, and allow matrices to be in the queue even if they have no
-        // unfinished computations.  See also GB_setElement.
-
-        GB_CRITICAL (GB_queue_remove (C)) ;
-    }
-    else
-    { 
-        // If C has any zombies or pending tuples, it must be in the queue.
-        // The queue insert does nothing if C is already in the queue.
-        GB_CRITICAL (GB_queue_insert (C)) ;
-    }
+    // C may be in the queue from a prior assignment, and this assignment can
+    // bring zombies back to life so that the zombie count goes to zero.  C is
+    // left in the queue in that case; matrices may be in the queue even if
+    // they have no unfinished computations.  If C has any zombies or pending
+    // tuples, it must be in the queue.  The queue insert does nothing if C is
+    // already in the queue, or if it has no work to do.
+    GB_CRITICAL (GB_queue_insert (C)) ;
 
     //--------------------------------------------------------------------------
     // finalize C and return result
@@ -144,7 +144,7 @@ GrB_Info GB_subref_slice
     // allocate workspace
     //--------------------------------------------------------------------------
 
-    GB_MALLOC_MEMORY (Cwork, Cnvec+1, sizeof (int64_t)) ;
+    GB_ARENA_MALLOC (Cwork, Cnvec+1, sizeof (int64_t)) ;
     if (Cwork == NULL)
     { 
         // out of memory
@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+// GB_trace: trace of the internal phases
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Compiled only with -DGBTRACE; otherwise GB_TRACE_BEGIN and GB_TRACE_END are
+// empty and this file is empty.
+
+// Each event is appended to a single buffer of GB_TRACE_MAX events, shared by
+// all threads.  A thread claims a slot with an atomic increment, so events of
+// different threads are interleaved in no particular order, but the events of
+// one thread are in the order they occurred.  Once the buffer is full, further
+// events are dropped (and counted) until the trace is written.
+
+// Each thread is given its own id the first time it records an event, since
+// omp_get_thread_num is only unique within one parallel region.
+
+// The trace is written in the Chrome trace event format (JSON), which can be
+// loaded in chrome://tracing or https://ui.perfetto.dev.
+
+// These functions are defined here:
+
+//      GB_trace_event:     record the start or end of a phase
+//      GB_trace_write:     write and clear the trace
+
+#include "GB.h"
+
+#ifdef GBTRACE
+
+#include <time.h>
+
+#define GB_TRACE_MAX (1 << 20)
+
+typedef struct
+{
+    const char *name ;          // name of the phase, a string literal
+    double time ;               // wall-clock time, in seconds
+    int tid ;                   // id of the thread
+    char phase ;                // 'B' or 'E'
+}
+GB_trace_struct ;
+
+static GB_trace_struct GB_trace [GB_TRACE_MAX] ;
+static int64_t GB_trace_count = 0 ;     // # of events recorded or dropped
+static int GB_trace_nthreads = 0 ;      // # of thread ids given out
+static _Thread_local int GB_trace_tid = 0 ;     // id of this thread, if > 0
+
+static double GB_trace_time (void)
+{
+    #if defined ( _OPENMP )
+    return (omp_get_wtime ( )) ;
+    #else
+    return ((double) clock ( ) / (double) CLOCKS_PER_SEC) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_trace_event: record the start or end of a phase
+//------------------------------------------------------------------------------
+
+void GB_trace_event
+(
+    const char *name,           // name of the phase, a string literal
+    char phase                  // 'B' to begin the phase, 'E' to end it
+)
+{
+
+    if (GB_trace_tid == 0)
+    { 
+        int tid ;
+        #pragma omp atomic capture
+        tid = ++GB_trace_nthreads ;
+        GB_trace_tid = tid ;
+    }
+
+    int64_t k ;
+    #pragma omp atomic capture
+    k = GB_trace_count++ ;
+    if (k < GB_TRACE_MAX)
+    { 
+        GB_trace [k].name  = name ;
+        GB_trace [k].time  = GB_trace_time ( ) ;
+        GB_trace [k].tid   = GB_trace_tid ;
+        GB_trace [k].phase = phase ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_trace_write: write and clear the trace
+//------------------------------------------------------------------------------
+
+// Returns false if the file could not be written.  The trace is cleared in
+// either case.  No other thread may be recording events.
+
+bool GB_trace_write             // write and clear the trace
+(
+    FILE *f                     // file to write the trace to
+)
+{
+
+    int64_t count = GB_trace_count ;
+    int64_t n = GB_IMIN (count, GB_TRACE_MAX) ;
+
+    // times are in microseconds, relative to the earliest event
+    double t0 = (n > 0) ? GB_trace [0].time : 0 ;
+    for (int64_t k = 1 ; k < n ; k++)
+    { 
+        t0 = GB_IMIN (t0, GB_trace [k].time) ;
+    }
+
+    bool ok = (fprintf (f, "{\"traceEvents\": [") > 0) ;
+    for (int64_t k = 0 ; ok && k < n ; k++)
+    { 
+        ok = (fprintf (f, "%s\n{\"name\": \"%s\", \"ph\": \"%c\", "
+            "\"ts\": %.3f, \"pid\": 1, \"tid\": %d}", (k == 0) ? "" : ",",
+            GB_trace [k].name, GB_trace [k].phase,
+            1e6 * (GB_trace [k].time - t0), GB_trace [k].tid) > 0) ;
+    }
+    ok = ok && (fprintf (f, "\n], \"displayTimeUnit\": \"ms\", "
+        "\"otherData\": {\"dropped\": "GBd"}}\n", count - n) > 0) ;
+
+    GB_trace_count = 0 ;
+    return (ok) ;
+}
+
+#endif
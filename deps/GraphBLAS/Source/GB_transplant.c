@@ -33,14 +33,14 @@ GrB_Info GB_transplant          // transplant one matrix into another
 
     ASSERT (Ahandle != NULL) ;
     GrB_Matrix A = *Ahandle ;
-    ASSERT (!GB_aliased (C, A)) ;
 
     ASSERT (C != NULL) ;
     ASSERT_OK (GB_check (A, "A before transplant", GB0)) ;
     ASSERT_OK (GB_check (ctype, "new type for C", GB0)) ;
 
-    // pending tuples may not appear in A
+    // pending tuples may not appear in A, and A cannot be a view
     ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_IS_VIEW (A)) ;
 
     // zombies in A can be safely transplanted into C
     ASSERT (GB_ZOMBIES_OK (A)) ;
@@ -51,6 +51,38 @@ GrB_Info GB_transplant          // transplant one matrix into another
     // the ctype and A->type must be compatible.  C->type is ignored
     ASSERT (GB_Type_compatible (ctype, A->type)) ;
 
+    //--------------------------------------------------------------------------
+    // make A->p and A->h private to A
+    //--------------------------------------------------------------------------
+
+    // A->p and A->h may be shallow copies of another matrix, which can be C
+    // itself (the output of GB_AxB_dot3 shares the pattern of its mask, and
+    // the mask can be aliased with C).  They must be copied before C is
+    // freed.  If A has zombies, pruning them creates new vector pointers, so
+    // only the hyperlist (if any) is left to copy.
+
+    if (A->p_shallow || A->h_shallow)
+    {
+        GrB_Info info = GrB_SUCCESS ;
+        if (GB_ZOMBIES (A))
+        { 
+            info = GB_wait (A, Context) ;
+        }
+        if (info == GrB_SUCCESS)
+        { 
+            info = GB_ph_unshare (A, Context) ;
+        }
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_MATRIX_FREE (Ahandle) ;
+            return (info) ;
+        }
+    }
+
+    ASSERT (!A->p_shallow && !A->h_shallow) ;
+    ASSERT (!GB_aliased (C, A)) ;
+
     //--------------------------------------------------------------------------
     // determine the number of threads to use
     //--------------------------------------------------------------------------
@@ -93,70 +125,14 @@ GrB_Info GB_transplant          // transplant one matrix into another
     // transplant A->p vector pointers and A->h hyperlist
     //--------------------------------------------------------------------------
 
-    if (A->p_shallow || A->h_shallow)
-    {
-
-        //----------------------------------------------------------------------
-        // A->p or A->h are shallow copies another matrix; make a deep copy
-        //----------------------------------------------------------------------
-
-        if (A->is_hyper)
-        {
-            // A is hypersparse, create new C->p and C->h
-            C->plen = anvec ;
-            C->nvec = anvec ;
-            GB_MALLOC_MEMORY (C->p, C->plen+1, sizeof (int64_t)) ;
-            GB_MALLOC_MEMORY (C->h, C->plen,   sizeof (int64_t)) ;
-            if (C->p == NULL || C->h == NULL)
-            { 
-                // out of memory
-                GB_PHIX_FREE (C) ;
-                GB_MATRIX_FREE (Ahandle) ;
-                return (GB_OUT_OF_MEMORY) ;
-            }
-
-            // copy A->p and A->h into the newly created C->p and C->h
-            GB_memcpy (C->p, A->p, (anvec+1) * sizeof (int64_t), nthreads) ;
-            GB_memcpy (C->h, A->h,  anvec    * sizeof (int64_t), nthreads) ;
-        }
-        else
-        {
-            // A is non-hypersparse, create new C->p
-            C->plen = A->vdim ;
-            C->nvec = A->vdim ;
-            GB_MALLOC_MEMORY (C->p, C->plen+1, sizeof (int64_t)) ;
-            if (C->p == NULL)
-            { 
-                // out of memory
-                GB_PHIX_FREE (C) ;
-                GB_MATRIX_FREE (Ahandle) ;
-                return (GB_OUT_OF_MEMORY) ;
-            }
-
-            // copy A->p into the newly created C->p
-            GB_memcpy (C->p, A->p, (A->vdim+1) * sizeof (int64_t), nthreads) ;
-        }
-
-        // free any non-shallow A->p and A->h content of A
-        GB_ph_free (A) ;
-
-    }
-    else
-    { 
-
-        //----------------------------------------------------------------------
-        // both A->p and A->h are not shallow: quick transplant into C
-        //----------------------------------------------------------------------
-
-        // Quick transplant of A->p and A->h into C.  This works for both
-        // standard and hypersparse cases.
-        ASSERT (C->p == NULL) ;
-        ASSERT (C->h == NULL) ;
-        C->p = A->p ;
-        C->h = A->h ;
-        C->plen = A->plen ;
-        C->nvec = anvec ;
-    }
+    // Quick transplant of A->p and A->h into C.  This works for both
+    // standard and hypersparse cases.
+    ASSERT (C->p == NULL) ;
+    ASSERT (C->h == NULL) ;
+    C->p = A->p ;
+    C->h = A->h ;
+    C->plen = A->plen ;
+    C->nvec = anvec ;
 
     // A->p and A->h have been freed or removed from A
     A->p = NULL ;
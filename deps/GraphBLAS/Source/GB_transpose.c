@@ -332,6 +332,8 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
             GB_FREE_A_AND_C ;
             return (GB_OUT_OF_MEMORY) ;
         }
+        GB_numa_place (Ci, anz * sizeof (int64_t), nthreads) ;
+        GB_numa_place (Cx, anz * ctype->size, nthreads) ;
 
         //----------------------------------------------------------------------
         // the transpose will now succeed; fill the content of C
@@ -459,6 +461,14 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
             GB_FREE_A_AND_C ;
             return (GB_OUT_OF_MEMORY) ;
         }
+        if (allocate_new_Ci)
+        { 
+            GB_numa_place (Ci, anz * sizeof (int64_t), nthreads) ;
+        }
+        if (allocate_new_Cx)
+        { 
+            GB_numa_place (Cx, anz * ctype->size, nthreads) ;
+        }
 
         //----------------------------------------------------------------------
         // numerical values of C: apply the op, typecast, or make shallow copy
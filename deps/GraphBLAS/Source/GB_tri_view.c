@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+// GB_tri_view: view the entries of a matrix on one side of its diagonal
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// As in GB_split_tri, the entries of each vector A(:,j) are partitioned in
+// terms of the indices i and j of the data structure.  If before is true, the
+// view V holds the entries with i < j, which are a prefix of each vector.
+// Otherwise, V holds the entries with i > j, which are a suffix.  The caller
+// decides which of these is the lower or upper triangular part, depending on
+// the CSR/CSC format of A.
+
+// The entries are not copied.  V->i and V->x are shallow pointers to A->i and
+// A->x, and the kth vector of V is held in positions Vp [k] to Ve [k]-1 of
+// those arrays, where Ve = V->e (see Template/GB_matrix.h).  V has its own
+// V->p, V->e, and V->h, so it takes O(A->plen) memory.  V has the same type,
+// format, and vectors as A (including any vectors that are empty in V).
+
+// A must not have any pending tuples or zombies, and must not be a view
+// itself.  A must not be modified or freed while V exists, unless V is
+// first copied into a standard matrix by GB_wait.
+
+#include "GB_select.h"
+
+#define GB_FREE_ALL                                                     \
+{                                                                       \
+    GB_FREE_MEMORY (Vp, aplen+1, sizeof (int64_t)) ;                    \
+    GB_FREE_MEMORY (Ve, aplen+1, sizeof (int64_t)) ;                    \
+    GB_FREE_MEMORY (Vh, aplen,   sizeof (int64_t)) ;                    \
+    GB_MATRIX_FREE (Vhandle) ;                                          \
+}
+
+GrB_Info GB_tri_view        // view the entries of A on one side of its diagonal
+(
+    GrB_Matrix *Vhandle,    // output view
+    const bool before,      // if true, view the entries A(i,j) with i < j,
+                            // otherwise view the entries with i > j
+    const GrB_Matrix A,     // input matrix
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Vhandle != NULL) ;
+    ASSERT_OK (GB_check (A, "A input for GB_tri_view", GB0)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_IS_VIEW (A)) ;
+    (*Vhandle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ai = A->i ;
+    int64_t aplen = A->plen ;
+    int64_t anvec = A->nvec ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the vector pointers of the view
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Vp = NULL ;
+    int64_t *restrict Ve = NULL ;
+    int64_t *restrict Vh = NULL ;
+    GB_MALLOC_MEMORY (Vp, aplen+1, sizeof (int64_t)) ;
+    GB_MALLOC_MEMORY (Ve, aplen+1, sizeof (int64_t)) ;
+    if (A->is_hyper)
+    {
+        GB_MALLOC_MEMORY (Vh, aplen, sizeof (int64_t)) ;
+    }
+    if (Vp == NULL || Ve == NULL || (A->is_hyper && Vh == NULL))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the diagonal in each vector
+    //--------------------------------------------------------------------------
+
+    int64_t vnz = 0 ;
+    int64_t vnvec_nonempty = 0 ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:vnz,vnvec_nonempty)
+    for (int64_t k = 0 ; k < anvec ; k++)
+    {
+        int64_t j = (Ah == NULL) ? k : Ah [k] ;
+        int64_t pA_start = Ap [k] ;
+        int64_t pA_end = Ap [k+1] ;
+        int64_t pleft = pA_start ;
+        int64_t pright = pA_end - 1 ;
+        bool found ;
+        GB_BINARY_SPLIT_SEARCH (j, Ai, pleft, pright, found) ;
+        // A(pA_start:pleft-1,j) is above the diagonal, A(pleft,j) is the
+        // diagonal if found, and the rest of A(:,j) is below it
+        if (before)
+        {
+            Vp [k] = pA_start ;
+            Ve [k] = pleft ;
+        }
+        else
+        {
+            Vp [k] = pleft + (found ? 1 : 0) ;
+            Ve [k] = pA_end ;
+        }
+        if (Vh != NULL) Vh [k] = j ;
+        int64_t vknz = Ve [k] - Vp [k] ;
+        vnz += vknz ;
+        vnvec_nonempty += (vknz > 0) ? 1 : 0 ;
+    }
+
+    // Vp [anvec] is set so that GB_NNZ (V) is the number of entries in V
+    Vp [anvec] = (anvec == 0) ? 0 : (Vp [0] + vnz) ;
+    Ve [anvec] = Vp [anvec] ;
+
+    //--------------------------------------------------------------------------
+    // create the view
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_NEW (Vhandle, A->type, A->vlen, A->vdim, GB_Ap_null, A->is_csc,
+        GB_SAME_HYPER_AS (A->is_hyper), A->hyper_ratio, aplen, Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    GrB_Matrix V = (*Vhandle) ;
+    V->p = Vp ;
+    V->e = Ve ;
+    V->h = Vh ;
+    V->plen = aplen ;
+    V->nvec = anvec ;
+    V->nvec_nonempty = vnvec_nonempty ;
+
+    if (A->nzmax > 0)
+    {
+        // V->i and V->x are shallow pointers into A
+        V->i = A->i ;
+        V->x = A->x ;
+        V->i_shallow = true ;
+        V->x_shallow = true ;
+        V->nzmax = A->nzmax ;
+    }
+
+    V->magic = GB_MAGIC ;
+    ASSERT_OK (GB_check (V, "V output for GB_tri_view", GB0)) ;
+    return (GrB_SUCCESS) ;
+}
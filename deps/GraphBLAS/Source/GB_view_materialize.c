@@ -0,0 +1,132 @@
+//------------------------------------------------------------------------------
+// GB_view_materialize: copy a view into a standard matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// A view (see GxB_Matrix_tri_view) has shallow A->i and A->x arrays that
+// belong to another matrix, and its kth vector is held in positions Ap [k] to
+// Ae [k]-1 of those arrays.  The entries of the view are copied into new A->i
+// and A->x arrays, so that A becomes a standard matrix that no longer depends
+// on the matrix it was a view of.  A->e becomes the new A->p, and the old A->p
+// is freed.  A->h is unchanged.  If out of memory, A is not modified.
+
+// This is called only by GB_wait, so a view is seen by all methods (except
+// GB_AxB_dot3 and GB_reduce_to_scalar) as a matrix with pending work.
+
+#include "GB.h"
+
+GrB_Info GB_view_materialize    // copy a view into a standard matrix
+(
+    GrB_Matrix A,               // view to convert, in place
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_OK (GB_check (A, "view to materialize", GB0)) ;
+    ASSERT (GB_IS_VIEW (A)) ;
+    ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!A->p_shallow && !A->h_shallow) ;
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Ap = A->p ;
+    int64_t *restrict Ae = A->e ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_void *restrict Ax = A->x ;
+    int64_t asize = A->type->size ;
+    int64_t anvec = A->nvec ;
+    int64_t anz = GB_NNZ (A) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz + anvec, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the new content of A
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Ci = NULL ;
+    GB_void *restrict Cx = NULL ;
+    if (anz > 0)
+    {
+        GB_MALLOC_MEMORY (Ci, anz, sizeof (int64_t)) ;
+        GB_MALLOC_MEMORY (Cx, anz, asize) ;
+        if (Ci == NULL || Cx == NULL)
+        {
+            // out of memory
+            GB_FREE_MEMORY (Ci, anz, sizeof (int64_t)) ;
+            GB_FREE_MEMORY (Cx, anz, asize) ;
+            return (GB_OUT_OF_MEMORY) ;
+        }
+        GB_numa_place (Ci, anz * sizeof (int64_t), nthreads) ;
+        GB_numa_place (Cx, anz * asize, nthreads) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the new vector pointers in place of Ae
+    //--------------------------------------------------------------------------
+
+    // Cp = Ae is overwritten with the length of each vector, and then its
+    // cumulative sum
+    int64_t *restrict Cp = Ae ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int64_t k = 0 ; k < anvec ; k++)
+    {
+        Cp [k] = Ae [k] - Ap [k] ;
+    }
+
+    GB_cumsum (Cp, anvec, NULL, nthreads) ;
+    ASSERT (Cp [anvec] == anz) ;
+
+    //--------------------------------------------------------------------------
+    // copy each vector of the view
+    //--------------------------------------------------------------------------
+
+    // vectors can have very different lengths, so they are scheduled
+    // dynamically
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,64)
+    for (int64_t k = 0 ; k < anvec ; k++)
+    {
+        int64_t pA = Ap [k] ;
+        int64_t pC = Cp [k] ;
+        int64_t ckz = Cp [k+1] - pC ;
+        if (ckz > 0)
+        {
+            memcpy (Ci + pC, Ai + pA, ckz * sizeof (int64_t)) ;
+            memcpy (Cx + pC * asize, Ax + pA * asize, ckz * asize) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // replace the content of A
+    //--------------------------------------------------------------------------
+
+    GB_FREE_MEMORY (A->p, A->plen+1, sizeof (int64_t)) ;
+    A->p = Cp ;
+    A->e = NULL ;
+
+    // A->i and A->x are shallow, so they are not freed
+    ASSERT (GB_IMPLIES (A->nzmax > 0, A->i_shallow && A->x_shallow)) ;
+    A->i = Ci ;
+    A->x = Cx ;
+    A->i_shallow = false ;
+    A->x_shallow = false ;
+    A->nzmax = anz ;
+
+    ASSERT_OK (GB_check (A, "materialized view", GB0)) ;
+    return (GrB_SUCCESS) ;
+}
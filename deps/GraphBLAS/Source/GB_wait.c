@@ -16,10 +16,12 @@
 // GrB_setElement and GrB_*assign.  Zombies must now be deleted, and pending
 // tuples must now be assembled together and added into the matrix.
 
-// When the function returns, the matrix has been removed from the queue
-// and all pending tuples and zombies have been deleted.  This is true even
-// the function fails due to lack of memory (in that case, the matrix is
-// cleared as well).
+// When the function returns, all pending tuples and zombies have been deleted.
+// This is true even the function fails due to lack of memory (in that case,
+// the matrix is cleared as well).  The matrix is left in the queue, if it is
+// there, so that a matrix repeatedly modified by GrB_setElement or
+// GrB_*assign and then used does not thrash the critical section of its
+// shard of the queue.  It is removed by GrB_wait, or when it is freed.
 
 // GrB_wait removes the head of the queue from the queue via
 // GB_queue_remove_head, and then passes the matrix to this function.  Thus is
@@ -35,11 +37,16 @@
 // If A is non-hypersparse, then O(n) is added in the worst case, to prune
 // zombies and to update the vector pointers for A.
 
+// All of the work is done in parallel: the zombies are pruned by GB_selector,
+// the pending tuples are sorted and assembled by GB_builder, and they are
+// merged into A either by appending them to the end of A, or with GB_add.  If
+// A has both zombies and pending tuples, the zombies are not pruned first;
+// GB_add skips them when it computes A+T, so A is traversed only once.
+
 #include "GB_select.h"
 #include "GB_add.h"
 #include "GB_Pending.h"
 #include "GB_build.h"
-#include "GB_jappend.h"
 
 #define GB_FREE_ALL                     \
 {                                       \
@@ -48,6 +55,19 @@
     GB_MATRIX_FREE (&S) ;               \
     GB_MATRIX_FREE (&(Aslice [0])) ;    \
     GB_MATRIX_FREE (&(Aslice [1])) ;    \
+    GB_TRACE_END ("GB_wait") ;          \
+}
+
+// record the telemetry of the wait (see GB_stats.c) if it succeeds
+#define GB_WAIT_RETURN(result)                                              \
+{                                                                           \
+    info = (result) ;                                                       \
+    GB_TRACE_END ("GB_wait") ;                                              \
+    if (info == GrB_SUCCESS)                                                \
+    {                                                                       \
+        GB_stats_end (&stats, GxB_STATS_WAIT, A, Context) ;                 \
+    }                                                                       \
+    return (info) ;                                                         \
 }
 
 GrB_Info GB_wait                // finish all pending computations
@@ -69,6 +89,21 @@ GrB_Info GB_wait                // finish all pending computations
     // with a negative pr.
     ASSERT_OK (GB_check (A, "A to wait", GB_FLIP (GB0))) ;
 
+    //--------------------------------------------------------------------------
+    // copy a view into a standard matrix
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_VIEW (A))
+    { 
+        // a view has no zombies or pending tuples, so nothing else is needed
+        return (GB_view_materialize (A, Context)) ;
+    }
+
+    // start recording the telemetry of this operation
+    GB_Stats_mark stats ;
+    GB_stats_begin (&stats, A, NULL, NULL, Context) ;
+    GB_TRACE_BEGIN ("GB_wait") ;
+
     //--------------------------------------------------------------------------
     // determine the max # of threads to use
     //--------------------------------------------------------------------------
@@ -90,7 +125,12 @@ GrB_Info GB_wait                // finish all pending computations
 
     int64_t nzombies = A->nzombies ;
 
-    if (nzombies > 0)
+    if (nzombies > 0 && GB_PENDING (A))
+    { 
+        // the zombies are deleted when the pending tuples are added, below
+        ;
+    }
+    else if (nzombies > 0)
     { 
         // remove all zombies from A.  Also compute A->nvec_nonempty
         #ifdef GB_DEBUG
@@ -101,6 +141,7 @@ GrB_Info GB_wait                // finish all pending computations
         ASSERT (A->nvec_nonempty == GB_nvec_nonempty (A, NULL)) ;
         ASSERT (A->nzombies == (anz_orig - GB_NNZ (A))) ;
         A->nzombies = 0 ;
+        nzombies = 0 ;
     }
     else if (A->nvec_nonempty < 0)
     { 
@@ -108,21 +149,21 @@ GrB_Info GB_wait                // finish all pending computations
         A->nvec_nonempty = GB_nvec_nonempty (A, Context) ;
     }
 
-    // all the zombies are gone
-    ASSERT (!GB_ZOMBIES (A)) ;
+    // all the zombies are gone, unless pending tuples are still to be added
+    ASSERT (GB_IMPLIES (GB_ZOMBIES (A), GB_PENDING (A))) ;
 
     //--------------------------------------------------------------------------
     // check for pending tuples
     //--------------------------------------------------------------------------
 
+    // anz includes any zombies in A
     int64_t anz = GB_NNZ (A) ;
 
     if (!GB_PENDING (A))
     { 
-        // nothing more to do; remove the matrix from the queue
+        // nothing more to do
         ASSERT (!GB_PENDING (A)) ;
-        GB_CRITICAL (GB_queue_remove (A)) ;
-        ASSERT (!(A->enqueued)) ;
+        ASSERT (!GB_ZOMBIES (A)) ;
 
         // trim any significant extra space from the matrix, but allow for some
         // future insertions.  do not increase the size of the matrix;
@@ -131,7 +172,7 @@ GrB_Info GB_wait                // finish all pending computations
         GB_OK (GB_ix_resize (A, anz, Context)) ;
 
         // conform A to its desired hypersparsity
-        return (GB_to_hyper_conform (A, Context)) ;
+        GB_WAIT_RETURN (GB_to_hyper_conform (A, Context)) ;
     }
 
     // There are pending tuples that will now be assembled.
@@ -190,17 +231,15 @@ GrB_Info GB_wait                // finish all pending computations
     GB_Pending_free (&(A->Pending)) ;
 
     //--------------------------------------------------------------------------
-    // remove the matrix from the queue
+    // A has no pending tuples, but is left in the queue
     //--------------------------------------------------------------------------
 
+    // A may still have zombies, and it may have been removed from the queue
+    // by GrB_wait, so the queue is not checked.
     ASSERT (!GB_PENDING (A)) ;
-    ASSERT (!GB_ZOMBIES (A)) ;
-    GB_CRITICAL (GB_queue_remove (A)) ;
-
-    // No pending operations on A, and A is not in the queue, so GB_check can
-    // now see the conditions it expects.
-    ASSERT (!(A->enqueued)) ;
-    ASSERT_OK (GB_check (A, "A after moving pending tuples to T", GB0)) ;
+    ASSERT (A->nzombies == nzombies) ;
+    ASSERT_OK (GB_check (A, "A after moving pending tuples to T",
+        GB_FLIP (GB0))) ;
 
     //--------------------------------------------------------------------------
     // check the status of the builder
@@ -221,11 +260,12 @@ GrB_Info GB_wait                // finish all pending computations
     // check for quick transplant
     //--------------------------------------------------------------------------
 
-    if (anz == 0)
+    if (anz == nzombies)
     { 
-        // A has no entries so just transplant T into A, then free T and
-        // conform A to its desired hypersparsity.
-        return (GB_transplant_conform (A, A->type, &T, Context)) ;
+        // A has no live entries so just transplant T into A, then free T and
+        // conform A to its desired hypersparsity.  Any zombies in A are
+        // freed by the transplant.
+        GB_WAIT_RETURN (GB_transplant_conform (A, A->type, &T, Context)) ;
     }
 
     //--------------------------------------------------------------------------
@@ -242,7 +282,6 @@ GrB_Info GB_wait                // finish all pending computations
     int64_t tjfirst = T->h [0] ;
     int64_t anz0 = 0 ;
     int64_t kA = 0 ;
-    int64_t jlast ;
 
     // anz0 = nnz (A0) = nnz (A (:, 0:tjfirst-1)), the region not modified by T
     if (A->is_hyper)
@@ -258,13 +297,11 @@ GrB_Info GB_wait                // finish all pending computations
         ASSERT (GB_IMPLIES (kA > 0 && kA < A->nvec, Ah [kA-1] < tjfirst)) ;
         ASSERT (GB_IMPLIES (found, Ah [kA] == tjfirst)) ;
         anz0 = A->p [kA] ;
-        jlast = Ah [kA-1] ;
     }
     else
     { 
         kA = tjfirst ;
         anz0 = A->p [tjfirst] ;
-        jlast = tjfirst - 1 ;
     }
 
     // anz1 = nnz (A1) = nnz (A (:, tjfirst:end)), the region modifed by T
@@ -273,7 +310,7 @@ GrB_Info GB_wait                // finish all pending computations
     // A + T will have anz_new entries
     int64_t anz_new = anz + GB_NNZ (T) ;  // must have at least this space
 
-    if (2 * anz1 < anz0)
+    if (nzombies == 0 && 2 * anz1 < anz0)
     {
 
         //----------------------------------------------------------------------
@@ -287,10 +324,11 @@ GrB_Info GB_wait                // finish all pending computations
         // If anz1 is zero, or small compared to anz0, then it is faster to
         // leave A0 unmodified, and to update just A1.
 
-        // FUTURE:: this does not tolerate zombies.  So do it only if A has no
-        // zombies on input.  Or, when GB_add can tolerate zombies, set the
-        // Aslice [1] to start at the first zombie.  Keep track of the vector
-        // containing the first zombie.
+        // This is not done if A has zombies, since A0 would have to be
+        // pruned as well.
+
+        // A->p and A->h are modified in place, so they cannot be shallow
+        GB_OK (GB_ph_unshare (A, Context)) ;
 
         // make sure A has enough space for the new tuples
         if (anz_new > A->nzmax)
@@ -324,8 +362,8 @@ GrB_Info GB_wait                // finish all pending computations
             GB_MATRIX_FREE (&(Aslice [0])) ;
 
             // S = A1 + T, but with no operator
-            GB_OK (GB_add (&S, A->type, A->is_csc, NULL, Aslice [1], T, NULL,
-                Context)) ;
+            GB_OK (GB_add (&S, A->type, A->is_csc, NULL, false, Aslice [1], T,
+                NULL, Context)) ;
 
             ASSERT_OK (GB_check (S, "S = A1+T", GB0)) ;
 
@@ -359,26 +397,62 @@ GrB_Info GB_wait                // finish all pending computations
         int64_t tnvec = T->nvec ;
         int64_t tnz = GB_NNZ (T) ;
 
-        anz = anz0 ;
-        int64_t anz_last = anz ;
-    
+        ASSERT (T->is_hyper) ;
+        ASSERT (Tp [0] == 0) ;
+        ASSERT (Th [0] >= tjfirst) ;
+
         int nthreads = GB_nthreads (tnz, chunk, nthreads_max) ;
 
         // append the indices and values of T to the end of A
-        GB_memcpy (Ai + anz        , Ti, tnz * sizeof (int64_t), nthreads) ;
-        GB_memcpy (Ax + anz * asize, Tx, tnz * asize           , nthreads) ;
+        GB_memcpy (Ai + anz0        , Ti, tnz * sizeof (int64_t), nthreads) ;
+        GB_memcpy (Ax + anz0 * asize, Tx, tnz * asize           , nthreads) ;
 
         // append the vectors of T to the end of A
-        for (int64_t k = 0 ; k < tnvec ; k++)
-        { 
-            int64_t j = Th [k] ;
-            ASSERT (j >= tjfirst) ;
-            anz += (Tp [k+1] - Tp [k]) ;
-            GB_OK (GB_jappend (A, j, &jlast, anz, &anz_last, Context)) ;
+        if (A->is_hyper)
+        {
+            // A->h [kA:kA+tnvec-1] = T->h, and A->p [kA+1:kA+tnvec] = anz0+T->p
+            if (kA + tnvec > A->plen)
+            { 
+                GB_OK (GB_hyper_realloc (A,
+                    GB_IMIN (A->vdim, 2 * (kA + tnvec)), Context)) ;
+            }
+            int64_t *restrict Ap = A->p ;
+            int64_t *restrict Ah = A->h ;
+            nthreads = GB_nthreads (tnvec, chunk, nthreads_max) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (int64_t k = 0 ; k < tnvec ; k++)
+            { 
+                Ah [kA + k] = Th [k] ;
+                Ap [kA + k + 1] = anz0 + Tp [k+1] ;
+            }
+            A->nvec = kA + tnvec ;
         }
-
-        GB_jwrapup (A, jlast, anz) ;
-        ASSERT (anz == anz_new) ;
+        else
+        {
+            // A(:,j) for j in the range Th [k] to Th [k+1]-1 ends where T(:,j)
+            // ends.  All vectors j >= tjfirst are modified, and Ap [tjfirst]
+            // is already equal to anz0.
+            int64_t *restrict Ap = A->p ;
+            int64_t avdim = A->vdim ;
+            nthreads = GB_nthreads (avdim - tjfirst, chunk, nthreads_max) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (int64_t k = 0 ; k < tnvec ; k++)
+            {
+                int64_t jnext = (k < tnvec-1) ? Th [k+1] : avdim ;
+                int64_t pend = anz0 + Tp [k+1] ;
+                for (int64_t j = Th [k] ; j < jnext ; j++)
+                { 
+                    Ap [j+1] = pend ;
+                }
+            }
+            // vectors tjfirst to Th [0]-1 are empty
+            for (int64_t j = tjfirst ; j < Th [0] ; j++)
+            { 
+                Ap [j+1] = anz0 ;
+            }
+        }
+        A->magic = GB_MAGIC ;
+        ASSERT (anz0 + tnz == anz_new) ;
 
         // recompute the # of non-empty vectors
         A->nvec_nonempty = GB_nvec_nonempty (A, Context) ;
@@ -388,7 +462,7 @@ GrB_Info GB_wait                // finish all pending computations
         GB_MATRIX_FREE (&T) ;
 
         // conform A to its desired hypersparsity
-        return (GB_to_hyper_conform (A, Context)) ;
+        GB_WAIT_RETURN (GB_to_hyper_conform (A, Context)) ;
 
     }
     else
@@ -398,18 +472,16 @@ GrB_Info GB_wait                // finish all pending computations
         // A = A+T
         //----------------------------------------------------------------------
 
-        // The update is not incremental since most of A is changing.  Just do
-        // a single parallel add: S=A+T, free T, and then transplant S back
-        // into A.  The nzmax of A is tight, with no room for future
-        // incremental growth.
-
-        // FUTURE:: if GB_add could tolerate zombies in A, then the initial
-        // prune of zombies can be skipped.
+        // The update is not incremental since most of A is changing, or A
+        // has zombies.  Just do a single parallel add: S=A+T, free T, and then
+        // transplant S back into A.  GB_add skips any zombies in A.  The nzmax
+        // of A is tight, with no room for future incremental growth.
 
-        GB_OK (GB_add (&S, A->type, A->is_csc, NULL, A, T, NULL, Context)) ;
+        GB_OK (GB_add (&S, A->type, A->is_csc, NULL, false, A, T, NULL,
+            Context)) ;
         GB_MATRIX_FREE (&T) ;
         ASSERT_OK (GB_check (S, "S after GB_wait:add", GB0)) ;
-        return (GB_transplant_conform (A, A->type, &S, Context)) ;
+        GB_WAIT_RETURN (GB_transplant_conform (A, A->type, &S, Context)) ;
     }
 }
 
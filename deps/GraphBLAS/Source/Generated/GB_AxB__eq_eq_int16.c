@@ -103,6 +103,7 @@ GrB_Info GB_AgusB__eq_eq_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
+    const bool Mask_struct,
     const GrB_Matrix A, bool A_is_pattern,
     const GrB_Matrix B, bool B_is_pattern,
     GB_Sauna Sauna
@@ -127,6 +128,7 @@ GrB_Info GB_Adot2B__eq_eq_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
+    const bool Mask_struct,
     const GrB_Matrix *Aslice, bool A_is_pattern,
     const GrB_Matrix B, bool B_is_pattern,
     int64_t *restrict *C_counts,
@@ -152,6 +154,7 @@ GrB_Info GB_Adot3B__eq_eq_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
+    const bool Mask_struct,
     const GrB_Matrix A, bool A_is_pattern,
     const GrB_Matrix B, bool B_is_pattern,
     const GB_task_struct *restrict TaskList,
@@ -177,6 +180,7 @@ GrB_Info GB_AheapB__eq_eq_int16
 (
     GrB_Matrix *Chandle,
     const GrB_Matrix M,
+    const bool Mask_struct,
     const GrB_Matrix A, bool A_is_pattern,
     const GrB_Matrix B, bool B_is_pattern,
     int64_t *restrict List,
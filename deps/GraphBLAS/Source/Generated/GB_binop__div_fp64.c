@@ -120,6 +120,7 @@ GrB_Info GB_AaddB__div_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
+    const bool Mask_struct,
     const GrB_Matrix A,
     const GrB_Matrix B,
     const bool Ch_is_Mh,
@@ -147,6 +148,7 @@ GrB_Info GB_AemultB__div_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
+    const bool Mask_struct,
     const GrB_Matrix A,
     const GrB_Matrix B,
     const int64_t *restrict C_to_M,
@@ -34,7 +34,8 @@ GrB_Info GrB_Vector_apply           // w<M> = accum (w, op(u))
     ASSERT (GB_VECTOR_OK (u)) ;
 
     // get the descriptor
-    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, xx1, xx2, xx3) ;
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        xx1, xx2, xx3) ;
 
     //--------------------------------------------------------------------------
     // apply the operator; do not transpose
@@ -42,7 +43,7 @@ GrB_Info GrB_Vector_apply           // w<M> = accum (w, op(u))
 
     return (GB_apply (
         (GrB_Matrix) w,     C_replace,      // w and its descriptor
-        (GrB_Matrix) M,     Mask_comp,      // mask and its descriptor
+        (GrB_Matrix) M,     Mask_comp, Mask_struct, // mask and its descriptor
         accum,                              // optional accum for Z=accum(C,T)
         op,                                 // operator to apply to the entries
         (GrB_Matrix) u,     false,          // u, not transposed
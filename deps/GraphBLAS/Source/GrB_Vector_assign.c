@@ -36,7 +36,8 @@ GrB_Info GrB_Vector_assign          // w<M>(Rows) = accum (w(Rows),u)
     ASSERT (GB_VECTOR_OK (u)) ;
 
     // get the descriptor
-    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, xx1, xx2, xx3) ;
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        xx1, xx2, xx3) ;
 
     //--------------------------------------------------------------------------
     // w(Rows)<M> = accum (w(Rows), u) and variations
@@ -48,7 +49,7 @@ GrB_Info GrB_Vector_assign          // w<M>(Rows) = accum (w(Rows),u)
 
     return (GB_assign (
         (GrB_Matrix) w,     C_replace,  // w vector and its descriptor
-        (GrB_Matrix) M,     Mask_comp,  // mask matrix and its descriptor
+        (GrB_Matrix) M,     Mask_comp, Mask_struct, // mask and its descriptor
         false,                          // do not transpose the mask
         accum,                          // for accum (C(Rows,Cols),A)
         (GrB_Matrix) u,     false,      // u as a matrix; never transposed
@@ -32,6 +32,9 @@ GrB_Info GrB_finalize ( )
         GB_Sauna_free (Sauna_id) ;
     }
 
+    // free the workspace arena of this thread
+    GB_arena_finalize ( ) ;
+
     //--------------------------------------------------------------------------
     // destroy the queue
     //--------------------------------------------------------------------------
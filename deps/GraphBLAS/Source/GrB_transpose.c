@@ -40,7 +40,8 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
     ASSERT_OK (GB_check (A, "A input for GrB_transpose", GB0)) ;
 
     // get the descriptor
-    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, A_transpose, xx1, xx2);
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, xx1, xx2);
 
     // check domains and dimensions for C<M> = accum (C,T)
     info = GB_compatible (C->type, C, M, accum, A->type, Context) ;
@@ -138,6 +139,7 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
     // C<M> = accum (C,T): accumulate the results into C via the mask M
     //--------------------------------------------------------------------------
 
-    return (GB_ACCUM_MASK (C, M, NULL, accum, &T, C_replace, Mask_comp)) ;
+    return (GB_ACCUM_MASK (C, M, NULL, accum, &T, C_replace, Mask_comp,
+        Mask_struct)) ;
 }
 
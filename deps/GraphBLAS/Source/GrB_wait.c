@@ -51,13 +51,10 @@ GrB_Info GrB_wait ( )       // finish all pending computations
     { 
         GB_CRITICAL (GB_queue_remove_head (&A)) ;
         if (A == NULL) break ;
-        // A has been removed from the head of the queue but it still has
-        // pending operations.  GB_check expects it to be in the queue.
-        // ASSERT_OK (GB_check (A, "to assemble in GrB_wait", GB0)) ;
-        // FUTURE:: allow matrices with no pending operations to be in the
-        // queue; this may help avoid thrashing the critical section.
-        ASSERT (GB_PENDING (A) || GB_ZOMBIES (A)) ;
-        // delete any lingering zombies and assemble any pending tuples.
+        // A has been removed from the head of the queue.  Matrices stay in
+        // the queue after their pending operations are finished, so A may
+        // have no work left to do.  Otherwise, delete any lingering zombies
+        // and assemble any pending tuples.
         GB_WAIT (A) ;
     }
 
@@ -62,12 +62,15 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
                 va_start (ap, field) ;
                 GrB_Desc_Value value = va_arg (ap, GrB_Desc_Value) ;
                 va_end (ap) ;
-                if (! (value == GxB_DEFAULT || value == GrB_SCMP))
+                if (! (value == GxB_DEFAULT || value == GrB_SCMP ||
+                       value == GxB_STRUCTURE || value == GxB_STRUCT_COMP))
                 { 
                     return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
                         "invalid descriptor value [%d] for GrB_MASK field;\n"
-                        "must be GxB_DEFAULT [%d] or GrB_SCMP [%d]",
-                        (int) value, (int) GxB_DEFAULT, (int) GrB_SCMP))) ;
+                        "must be GxB_DEFAULT [%d], GrB_SCMP [%d],\n"
+                        "GxB_STRUCTURE [%d], or GxB_STRUCT_COMP [%d]",
+                        (int) value, (int) GxB_DEFAULT, (int) GrB_SCMP,
+                        (int) GxB_STRUCTURE, (int) GxB_STRUCT_COMP))) ;
                 }
                 desc->mask = value ;
             }
@@ -152,6 +152,103 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // workspace arena
+        //----------------------------------------------------------------------
+
+        case GxB_ARENA : 
+
+            {
+                va_start (ap, field) ;
+                bool *arena = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (arena) ;
+                (*arena) = GB_Global_arena_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // NUMA placement of matrix content
+        //----------------------------------------------------------------------
+
+        case GxB_NUMA : 
+
+            {
+                va_start (ap, field) ;
+                GxB_NUMA_Policy *numa = va_arg (ap, GxB_NUMA_Policy *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (numa) ;
+                (*numa) = GB_Global_numa_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // transparent huge pages
+        //----------------------------------------------------------------------
+
+        case GxB_HUGE_PAGES : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *threshold = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (threshold) ;
+                (*threshold) = (int64_t) GB_Global_hugepage_threshold_get ( ) ;
+            }
+            break ;
+
+        case GxB_HUGE_PAGE_BYTES : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *bytes = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (bytes) ;
+                (*bytes) = GB_Global_hugepage_inuse_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // per-operation telemetry
+        //----------------------------------------------------------------------
+
+        case GxB_STATS : 
+
+            {
+                va_start (ap, field) ;
+                bool *stats = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (stats) ;
+                (*stats) = GB_Global_stats_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // memory usage
+        //----------------------------------------------------------------------
+
+        case GxB_MEMORY_INUSE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *inuse = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (inuse) ;
+                (*inuse) = GB_Global_memory_inuse_get ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_PEAK : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *peak = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (peak) ;
+                (*peak) = GB_Global_memory_peak_get ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // SuiteSparse:GraphBLAS version, etc
         //----------------------------------------------------------------------
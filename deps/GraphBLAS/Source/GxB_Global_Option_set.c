@@ -89,14 +89,79 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_ARENA : 
+
+            {
+                va_start (ap, field) ;
+                int arena = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_arena_set (arena != 0) ;
+            }
+            break ;
+
+        case GxB_NUMA : 
+
+            {
+                va_start (ap, field) ;
+                GxB_NUMA_Policy numa = va_arg (ap, GxB_NUMA_Policy) ;
+                va_end (ap) ;
+                if (! (numa == GxB_NUMA_NONE || numa == GxB_NUMA_FIRST_TOUCH
+                    || numa == GxB_NUMA_INTERLEAVE))
+                { 
+                    return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                            "unsupported NUMA policy [%d], must be one of:\n"
+                            "GxB_NUMA_NONE [%d], GxB_NUMA_FIRST_TOUCH [%d] or "
+                            "GxB_NUMA_INTERLEAVE [%d]", (int) numa,
+                            (int) GxB_NUMA_NONE, (int) GxB_NUMA_FIRST_TOUCH,
+                            (int) GxB_NUMA_INTERLEAVE))) ;
+                }
+                GB_Global_numa_set (numa) ;
+            }
+            break ;
+
+        case GxB_HUGE_PAGES : 
+
+            {
+                va_start (ap, field) ;
+                int64_t threshold = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                // a block smaller than one huge page is never put on huge
+                // pages; zero or less disables them
+                threshold = (threshold <= 0) ? 0 :
+                    GB_IMAX (threshold, (int64_t) GB_HUGEPAGE_SIZE) ;
+                GB_Global_hugepage_threshold_set ((size_t) threshold) ;
+            }
+            break ;
+
+        case GxB_STATS : 
+
+            {
+                va_start (ap, field) ;
+                int stats = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_stats_set (stats != 0) ;
+            }
+            break ;
+
+        case GxB_MEMORY_PEAK : 
+
+            // the value is not used; the high-water mark is reset to the
+            // # of bytes now in use
+            GB_Global_memory_peak_reset ( ) ;
+            break ;
+
         default : 
 
             return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
                     "invalid option field [%d], must be one of:\n"
-                    "GxB_HYPER [%d], GxB_FORMAT [%d], GxB_NTHREADS [%d]"
-                    " or GxB_CHUNK [%d]",
+                    "GxB_HYPER [%d], GxB_FORMAT [%d], GxB_NTHREADS [%d],"
+                    " GxB_CHUNK [%d], GxB_ARENA [%d], GxB_NUMA [%d],"
+                    " GxB_HUGE_PAGES [%d], GxB_STATS [%d] or"
+                    " GxB_MEMORY_PEAK [%d]",
                     (int) field, (int) GxB_HYPER, (int) GxB_FORMAT,
-                    (int) GxB_NTHREADS, (int) GxB_CHUNK))) ;
+                    (int) GxB_NTHREADS, (int) GxB_CHUNK, (int) GxB_ARENA,
+                    (int) GxB_NUMA, (int) GxB_HUGE_PAGES, (int) GxB_STATS,
+                    (int) GxB_MEMORY_PEAK))) ;
 
     }
 
@@ -84,6 +84,11 @@ GrB_Info GxB_Matrix_export_CSR  // export and free a CSR matrix
     }
     ASSERT ((*A)->h == NULL) ;
 
+    // the exported arrays now belong to the user
+    GB_EXPORT_RELEASE (Ap, (*A)->plen + 1, sizeof (int64_t)) ;
+    GB_EXPORT_RELEASE (Aj, (*A)->nzmax, sizeof (int64_t)) ;
+    GB_EXPORT_RELEASE (Ax, (*A)->nzmax, (*A)->type->size) ;
+
     //--------------------------------------------------------------------------
     // export is successful
     //--------------------------------------------------------------------------
@@ -96,6 +96,12 @@ GrB_Info GxB_Matrix_export_HyperCSR  // export and free a hypersparse CSR matrix
         (*Ax) = NULL ;
     }
 
+    // the exported arrays now belong to the user
+    GB_EXPORT_RELEASE (Ah, (*A)->plen, sizeof (int64_t)) ;
+    GB_EXPORT_RELEASE (Ap, (*A)->plen + 1, sizeof (int64_t)) ;
+    GB_EXPORT_RELEASE (Aj, (*A)->nzmax, sizeof (int64_t)) ;
+    GB_EXPORT_RELEASE (Ax, (*A)->nzmax, (*A)->type->size) ;
+
     //--------------------------------------------------------------------------
     // export is successful
     //--------------------------------------------------------------------------
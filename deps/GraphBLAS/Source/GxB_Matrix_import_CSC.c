@@ -55,6 +55,11 @@ GrB_Info GxB_Matrix_import_CSC      // import a CSC matrix
         return (info) ;
     }
 
+    // the imported arrays now belong to GraphBLAS
+    GB_IMPORT_ACQUIRE (Ap, ncols + 1, sizeof (int64_t)) ;
+    GB_IMPORT_ACQUIRE (Ai, nvals, sizeof (int64_t)) ;
+    GB_IMPORT_ACQUIRE (Ax, nvals, type->size) ;
+
     // transplant the user's content into the matrix
     (*A)->h = NULL ;
     (*A)->p = (int64_t *) (*Ap) ;
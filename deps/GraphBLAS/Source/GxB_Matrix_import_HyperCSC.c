@@ -63,6 +63,12 @@ GrB_Info GxB_Matrix_import_HyperCSC     // import a hypersparse CSC matrix
         return (info) ;
     }
 
+    // the imported arrays now belong to GraphBLAS
+    GB_IMPORT_ACQUIRE (Ah, nvec, sizeof (int64_t)) ;
+    GB_IMPORT_ACQUIRE (Ap, nvec + 1, sizeof (int64_t)) ;
+    GB_IMPORT_ACQUIRE (Ai, nvals, sizeof (int64_t)) ;
+    GB_IMPORT_ACQUIRE (Ax, nvals, type->size) ;
+
     // transplant the user's content into the matrix
     (*A)->h = (int64_t *) (*Ah) ;
     (*Ah) = NULL ;
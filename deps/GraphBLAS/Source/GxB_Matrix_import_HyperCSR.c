@@ -63,6 +63,12 @@ GrB_Info GxB_Matrix_import_HyperCSR     // import a hypersparse CSR matrix
         return (info) ;
     }
 
+    // the imported arrays now belong to GraphBLAS
+    GB_IMPORT_ACQUIRE (Ah, nvec, sizeof (int64_t)) ;
+    GB_IMPORT_ACQUIRE (Ap, nvec + 1, sizeof (int64_t)) ;
+    GB_IMPORT_ACQUIRE (Aj, nvals, sizeof (int64_t)) ;
+    GB_IMPORT_ACQUIRE (Ax, nvals, type->size) ;
+
     // transplant the user's content into the matrix
     (*A)->h = (int64_t *) (*Ah) ;
     (*Ah) = NULL ;
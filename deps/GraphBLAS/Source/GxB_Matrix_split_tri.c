@@ -0,0 +1,125 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_split_tri: split a matrix into its triangular and diagonal parts
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// L = tril (A,-1), D = diag (A), and U = triu (A,1), or the same for A' if
+// A is transposed by the descriptor.  Any of L, D, and U may be NULL.
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_MATRIX_FREE (&T [0]) ;               \
+    GB_MATRIX_FREE (&T [1]) ;               \
+    GB_MATRIX_FREE (&T [2]) ;               \
+}
+
+#include "GB_select.h"
+#include "GB_accum_mask.h"
+
+GrB_Info GxB_Matrix_split_tri       // L=tril(A,-1), D=diag(A), U=triu(A,1)
+(
+    GrB_Matrix L,                   // output: strictly lower part, or NULL
+    GrB_Matrix D,                   // output: diagonal part, or NULL
+    GrB_Matrix U,                   // output: strictly upper part, or NULL
+    const GrB_Matrix A,             // input matrix
+    const GrB_Descriptor desc       // descriptor for A
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_split_tri (L, D, U, A, desc)") ;
+    GB_RETURN_IF_FAULTY (L) ;
+    GB_RETURN_IF_FAULTY (D) ;
+    GB_RETURN_IF_FAULTY (U) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GrB_Matrix T [3] = { NULL, NULL, NULL } ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, A_transpose, xx4, xx5) ;
+
+    // L, D, and U may be aliased with A, but not with each other
+    if ((L != NULL && (L == D || L == U)) || (D != NULL && D == U))
+    {
+        return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+            "outputs L, D, and U must be distinct"))) ;
+    }
+
+    // check the domains and dimensions of each output
+    GrB_Matrix C [3] = { L, D, U } ;
+    int64_t tnrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t tncols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    for (int t = 0 ; t < 3 ; t++)
+    {
+        if (C [t] == NULL) continue ;
+        GB_OK (GB_compatible (C [t]->type, C [t], NULL, NULL, A->type,
+            Context)) ;
+        if (GB_NROWS (C [t]) != tnrows || GB_NCOLS (C [t]) != tncols)
+        {
+            return (GB_ERROR (GrB_DIMENSION_MISMATCH, (GB_LOG,
+                "Dimensions not compatible:\n"
+                "output is "GBd"-by-"GBd"\n"
+                "input is "GBd"-by-"GBd"%s",
+                GB_NROWS (C [t]), GB_NCOLS (C [t]),
+                tnrows, tncols, A_transpose ? " (transposed)" : ""))) ;
+        }
+    }
+
+    if (L == NULL && D == NULL && U == NULL)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GB_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // handle the CSR/CSC format and the transposed case
+    //--------------------------------------------------------------------------
+
+    // As in GB_select, A is not transposed explicitly.  GB_split_tri splits
+    // each vector A(:,j) at its diagonal, in terms of the indices (i,j) of
+    // the data structure.  If A is treated as CSC, the entries with i < j are
+    // in the upper triangular part, and if it is treated as CSR, they are in
+    // the lower triangular part.  Each part is then tagged with the format of
+    // A, and GB_accum_mask transposes it if its format differs from its
+    // output.
+
+    bool A_csc = (A->is_csc == !A_transpose) ;
+    GrB_Matrix Before = A_csc ? U : L ;
+    GrB_Matrix After  = A_csc ? L : U ;
+
+    //--------------------------------------------------------------------------
+    // split A into its parts, in a single pass
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_split_tri (
+        (Before == NULL) ? NULL : &T [0],
+        (D      == NULL) ? NULL : &T [1],
+        (After  == NULL) ? NULL : &T [2], A, Context)) ;
+
+    //--------------------------------------------------------------------------
+    // C = T for each output
+    //--------------------------------------------------------------------------
+
+    // all of A has been read, so the outputs may now overwrite A
+    C [0] = Before ;
+    C [1] = D ;
+    C [2] = After ;
+    for (int t = 0 ; t < 3 ; t++)
+    {
+        if (C [t] == NULL) continue ;
+        T [t]->is_csc = A_csc ;
+        ASSERT_OK (GB_check (T [t], "T=split(A) output", GB0)) ;
+        GB_OK (GB_ACCUM_MASK (C [t], NULL, NULL, NULL, &T [t], false,
+            false, false)) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
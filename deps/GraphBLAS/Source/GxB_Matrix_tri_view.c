@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_tri_view: view the triangular parts of a matrix, with no copy
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Creates L = tril (A,-1) and U = triu (A,1) as views of A: new matrices that
+// share the row/column indices and values of A, with only O(n) memory of
+// their own.  Either L or U may be NULL.  A must not be modified or freed
+// while either view exists.
+
+// GrB_mxm (and GrB_mxv, GrB_vxm) with a non-complemented mask that uses the
+// dot product method with no explicit transpose, and GrB_reduce to a scalar,
+// access a view directly.  All other methods first copy the view into a
+// standard matrix, just as they would finish any pending work.  GrB_free
+// frees a view but not the matrix A it refers to.
+
+#include "GB_select.h"
+
+GrB_Info GxB_Matrix_tri_view        // L = tril (A,-1) and U = triu (A,1)
+(
+    GrB_Matrix *L,                  // handle of view of tril (A,-1), or NULL
+    GrB_Matrix *U,                  // handle of view of triu (A,1), or NULL
+    const GrB_Matrix A              // matrix to view
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_tri_view (&L, &U, A)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    if (L != NULL && L == U)
+    {
+        return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+            "outputs L and U must be distinct"))) ;
+    }
+    if (L != NULL) (*L) = NULL ;
+    if (U != NULL) (*U) = NULL ;
+
+    // finish any pending work in A, and copy it if it is a view itself
+    GB_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // handle the CSR/CSC format
+    //--------------------------------------------------------------------------
+
+    // As in GxB_Matrix_split_tri, the entries A(i,j) with i < j in the data
+    // structure are in the upper triangular part if A is CSC, and in the
+    // lower triangular part if A is CSR.  The views take the format of A.
+
+    GrB_Matrix *Before = A->is_csc ? U : L ;
+    GrB_Matrix *After  = A->is_csc ? L : U ;
+
+    //--------------------------------------------------------------------------
+    // create the views
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    if (Before != NULL)
+    {
+        info = GB_tri_view (Before, true, A, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            return (info) ;
+        }
+    }
+    if (After != NULL)
+    {
+        info = GB_tri_view (After, false, A, Context) ;
+        if (info != GrB_SUCCESS)
+        {
+            // out of memory
+            if (Before != NULL) GB_MATRIX_FREE (Before) ;
+            return (info) ;
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
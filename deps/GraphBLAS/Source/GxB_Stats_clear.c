@@ -0,0 +1,23 @@
+//------------------------------------------------------------------------------
+// GxB_Stats_clear: empty the log of per-operation records
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// This function does not enable or disable recording; see GxB_STATS.
+
+#include "GB.h"
+
+GrB_Info GxB_Stats_clear    // empty the log of per-operation records
+(
+    void
+)
+{ 
+
+    GB_WHERE ("GxB_Stats_clear ( )") ;
+    GB_Global_stats_log_clear ( ) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// GxB_Stats_get: get the most recent per-operation records
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// On input, *nstats is the size of the stats array.  On output, stats [0..n-1]
+// holds the n most recent records, oldest first, where n = *nstats is the
+// smaller of the input *nstats, the # of records appended since the log was
+// last cleared, and GxB_STATS_LOG_SIZE.  The log is not modified.
+
+// This function must not be called while other user threads are running
+// GraphBLAS operations that are being recorded.
+
+#include "GB.h"
+
+GrB_Info GxB_Stats_get      // get the most recent per-operation records
+(
+    GxB_Stats *stats,       // array of size *nstats, oldest record first
+    GrB_Index *nstats       // input: size of stats, output: # of records
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Stats_get (stats, &nstats)") ;
+    GB_RETURN_IF_NULL (nstats) ;
+    if ((*nstats) > 0)
+    { 
+        GB_RETURN_IF_NULL (stats) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the records
+    //--------------------------------------------------------------------------
+
+    int64_t nmax = (int64_t) GB_IMIN ((*nstats), GxB_STATS_LOG_SIZE) ;
+    (*nstats) = (GrB_Index) GB_Global_stats_log_get (stats, nmax) ;
+    return (GrB_SUCCESS) ;
+}
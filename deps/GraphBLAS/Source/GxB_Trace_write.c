@@ -0,0 +1,59 @@
+//------------------------------------------------------------------------------
+// GxB_Trace_write: write the trace of the internal phases to a file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2019, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The trace is recorded only if GraphBLAS is compiled with -DGBTRACE (see
+// GB_trace.c).  Otherwise GrB_INVALID_VALUE is returned and no file is
+// written.  The trace is cleared once it has been written.
+
+// This function must not be called while other user threads are running
+// GraphBLAS operations.
+
+#include "GB.h"
+
+GrB_Info GxB_Trace_write    // write the trace to a file, and clear it
+(
+    const char *filename    // name of the file, in Chrome trace event format
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Trace_write (filename)") ;
+    GB_RETURN_IF_NULL (filename) ;
+
+    //--------------------------------------------------------------------------
+    // write the trace
+    //--------------------------------------------------------------------------
+
+    #ifdef GBTRACE
+
+        FILE *f = fopen (filename, "w") ;
+        if (f == NULL)
+        { 
+            return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                "cannot open trace file [%s]", filename))) ;
+        }
+        bool ok = GB_trace_write (f) ;
+        ok = (fclose (f) == 0) && ok ;
+        if (!ok)
+        { 
+            return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                "cannot write trace file [%s]", filename))) ;
+        }
+        return (GrB_SUCCESS) ;
+
+    #else
+
+        return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+            "tracing is disabled; compile GraphBLAS with -DGBTRACE"))) ;
+
+    #endif
+}
@@ -66,6 +66,10 @@ GrB_Info GxB_Vector_export  // export and free a vector
         (*vx) = NULL ;
     }
 
+    // the exported arrays now belong to the user
+    GB_EXPORT_RELEASE (vi, (*v)->nzmax, sizeof (int64_t)) ;
+    GB_EXPORT_RELEASE (vx, (*v)->nzmax, (*v)->type->size) ;
+
     //--------------------------------------------------------------------------
     // export is successful
     //--------------------------------------------------------------------------
@@ -68,6 +68,10 @@ GrB_Info GxB_Vector_import  // import a vector in CSC format
         return (info) ;
     }
 
+    // the imported arrays now belong to GraphBLAS
+    GB_IMPORT_ACQUIRE (vi, nvals, sizeof (int64_t)) ;
+    GB_IMPORT_ACQUIRE (vx, nvals, type->size) ;
+
     // transplant the user's content into the vector
     (*v)->nzmax = nvals ;
     (*v)->p [1] = nvals ;
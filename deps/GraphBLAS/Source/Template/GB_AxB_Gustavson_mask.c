@@ -50,7 +50,7 @@
 
     const int64_t *restrict Mp = M->p ;
     const int64_t *restrict Mi = M->i ;
-    const GB_void *restrict Mx = M->x ;
+    const GB_void *restrict Mx = (Mask_struct ? NULL : M->x) ;
     GB_cast_function cast_M = GB_cast_factory (GB_BOOL_code, M->type->code) ;
     size_t msize = M->type->size ;
     #ifdef GB_HYPER_CASE
@@ -187,8 +187,7 @@
                 for (int64_t pM = pM_start ; pM < pM_end ; pM++)
                 {
                     // mij = (bool) M (i,j)
-                    bool mij ;
-                    cast_M (&mij, Mx +(pM*msize), 0) ;
+                    bool mij = GB_mcast (Mx, pM, msize, cast_M) ;
                     if (mij)
                     { 
                         // M(i,j) is true
@@ -51,7 +51,7 @@
         const int64_t *restrict Mp = M->p ;
         const int64_t *restrict Mh = M->h ;
         const int64_t *restrict Mi = M->i ;
-        const GB_void *restrict Mx = M->x ;
+        const GB_void *restrict Mx = (Mask_struct ? NULL : M->x) ;
         GB_cast_function cast_M = GB_cast_factory (GB_BOOL_code, M->type->code);
         size_t msize = M->type->size ;
         const int64_t mnvec = M->nvec ;
@@ -23,6 +23,7 @@
     GB_CTYPE *restrict Cx = C->x ;
 
     const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Be = GB_VECTOR_ENDS (B) ;
     const int64_t *restrict Bh = B->h ;
     const int64_t *restrict Bi = B->i ;
     const GB_BTYPE *restrict Bx = B_is_pattern ? NULL : B->x ;
@@ -30,13 +31,15 @@
     const int64_t bnvec = B->nvec ;
     const bool B_is_hyper = B->is_hyper ;
 
+    const int64_t *restrict Mp = M->p ;
     const int64_t *restrict Mi = M->i ;
-    const GB_void *restrict Mx = M->x ;
+    const GB_void *restrict Mx = (Mask_struct ? NULL : M->x) ;
     GB_cast_function cast_M = GB_cast_factory (GB_BOOL_code, M->type->code) ;
     const size_t msize = M->type->size ;
 
     const int64_t *restrict Ah = A->h ;
     const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ae = GB_VECTOR_ENDS (A) ;
     const int64_t *restrict Ai = A->i ;
     const int64_t anvec = A->nvec ;
     const bool A_is_hyper = GB_IS_HYPER (A) ;
@@ -47,13 +50,15 @@
     //--------------------------------------------------------------------------
 
     // C and M have the same pattern, except some entries of C may become
-    // zombies.
+    // zombies.  C(i,j) is Cx [pC], and M(i,j) is Mx [pC+mshift], where mshift
+    // is nonzero only if M is a view.
     int64_t nzombies = 0 ;
 
     #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
         reduction(+:nzombies)
     for (int taskid = 0 ; taskid < ntasks ; taskid++)
     {
+        GB_TRACE_BEGIN ("dot3 task") ;
 
         //----------------------------------------------------------------------
         // get the task descriptor
@@ -97,13 +102,14 @@
                 pC_start = Cp [k] ;
                 pC_end   = Cp [k+1] ;
             }
+            int64_t mshift = Mp [k] - Cp [k] ;
 
             //------------------------------------------------------------------
             // get B(:,j)
             //------------------------------------------------------------------
 
             int64_t pB_start, pB_end ;
-            GB_lookup (B_is_hyper, Bh, Bp, &bpleft, bnvec-1, j,
+            GB_lookup_view (B_is_hyper, Bh, Bp, Be, &bpleft, bnvec-1, j,
                 &pB_start, &pB_end) ;
             int64_t bjnz = pB_end - pB_start ;
 
@@ -122,7 +128,7 @@
                 for (int64_t pC = pC_start ; pC < pC_end ; pC++)
                 { 
                     // C(i,j) is a zombie
-                    Ci [pC] = GB_FLIP (Mi [pC]) ;
+                    Ci [pC] = GB_FLIP (Mi [pC + mshift]) ;
                 }
             }
             else
@@ -144,9 +150,8 @@
                     //----------------------------------------------------------
 
                     // get the value of M(i,j)
-                    int64_t i = Mi [pC] ;
-                    bool mij ;
-                    cast_M (&mij, Mx +(pC*msize), 0) ;
+                    int64_t i = Mi [pC + mshift] ;
+                    bool mij = GB_mcast (Mx, pC + mshift, msize, cast_M) ;
                     if (mij)
                     { 
 
@@ -156,8 +161,8 @@
 
                         // get A(:,i), if it exists
                         int64_t pA, pA_end ;
-                        GB_lookup (A_is_hyper, Ah, Ap, &apleft, anvec-1, i,
-                            &pA, &pA_end) ;
+                        GB_lookup_view (A_is_hyper, Ah, Ap, Ae, &apleft,
+                            anvec-1, i, &pA, &pA_end) ;
 
                         // C(i,j) = A(:,i)'*B(:,j)
                         #include "GB_AxB_dot_cij.c"
@@ -181,6 +186,7 @@
         //----------------------------------------------------------------------
 
         nzombies += task_nzombies ;
+        GB_TRACE_END ("dot3 task") ;
     }
 
     //--------------------------------------------------------------------------
@@ -29,7 +29,7 @@
     const int64_t *restrict Mp = M->p ;
     const int64_t *restrict Mh = M->h ;
     const int64_t *restrict Mi = M->i ;
-    const GB_void *restrict Mx = M->x ;
+    const GB_void *restrict Mx = (Mask_struct ? NULL : M->x) ;
     GB_cast_function cast_M = GB_cast_factory (GB_BOOL_code, M->type->code);
     size_t msize = M->type->size ;
     const int64_t mnvec = M->nvec ;
@@ -227,7 +227,7 @@
             bool mij = false ;
             if (i == Mi [pM])
             { 
-                cast_M (&mij, Mx +(pM*msize), 0) ;
+                mij = GB_mcast (Mx, pM, msize, cast_M) ;
                 pM++ ;
             }
             int64_t im_next = (pM < pM_end) ? Mi [pM] : cvlen ;
@@ -18,6 +18,10 @@
 
 // phase2: computes C, using the counts computed by phase1.
 
+// A may have zombies only when GB_wait computes A+T with no mask, where T is
+// the matrix of pending tuples of A.  The zombies are skipped, so that they
+// are pruned from A in the same pass that merges in the pending tuples.
+
 {
 
     //--------------------------------------------------------------------------
@@ -27,6 +31,7 @@
     const int64_t *restrict Ap = A->p ;
     const int64_t *restrict Ai = A->i ;
     const int64_t vlen = A->vlen ;
+    const bool A_has_zombies = (A->nzombies > 0) ;
 
     const int64_t *restrict Bp = B->p ;
     const int64_t *restrict Bi = B->i ;
@@ -42,7 +47,7 @@
         Mp = M->p ;
         // Mh = M->h ;
         Mi = M->i ;
-        Mx = M->x ;
+        Mx = (Mask_struct ? NULL : M->x) ;
         cast_M = GB_cast_factory (GB_BOOL_code, M->type->code) ;
         msize = M->type->size ;
     }
@@ -201,6 +206,52 @@
 
                 // if present, M(:,j) is ignored since !M(:,j) is all true
 
+                if (A_has_zombies)
+                {
+
+                    //----------------------------------------------------------
+                    // A(:,j) may have zombies, and is disjoint with B(:,j)
+                    //----------------------------------------------------------
+
+                    // only used by GB_wait, which computes A+T where T is the
+                    // matrix of pending tuples for A, and A has zombies.  The
+                    // zombies in A(:,j) are skipped.
+
+                    #if defined ( GB_PHASE_1_OF_2 )
+                    cjnz = bjnz ;
+                    for (int64_t p = pA ; p < pA_end ; p++)
+                    { 
+                        if (GB_IS_NOT_ZOMBIE (Ai [p])) cjnz++ ;
+                    }
+                    #else
+                    for ( ; pA < pA_end ; pA++)
+                    {
+                        int64_t i = Ai [pA] ;
+                        if (GB_IS_ZOMBIE (i)) continue ;
+                        // C(iB,j) = B(iB,j) for all iB < i
+                        for ( ; pB < pB_end && Bi [pB] < i ; pB++, pC++)
+                        { 
+                            Ci [pC] = Bi [pB] ;
+                            GB_COPY_B_TO_C (GB_CX (pC), Bx, pB) ;
+                        }
+                        ASSERT (pB == pB_end || Bi [pB] > i) ;
+                        // C(i,j) = A(i,j)
+                        Ci [pC] = i ;
+                        GB_COPY_A_TO_C (GB_CX (pC), Ax, pA) ;
+                        pC++ ;
+                    }
+                    // C(iB,j) = B(iB,j) for the remainder of B(:,j)
+                    for ( ; pB < pB_end ; pB++, pC++)
+                    { 
+                        Ci [pC] = Bi [pB] ;
+                        GB_COPY_B_TO_C (GB_CX (pC), Bx, pB) ;
+                    }
+                    ASSERT (pC == pC_end) ;
+                    #endif
+
+                }
+                else
+
                 #if defined ( GB_PHASE_1_OF_2 )
 
                 if (A_and_B_are_disjoint)
@@ -551,8 +602,7 @@
                     //----------------------------------------------------------
 
                     int64_t i = Mi [pM] ;
-                    bool mij ;
-                    cast_M (&mij, Mx +(pM*msize), 0) ;
+                    bool mij = GB_mcast (Mx, pM, msize, cast_M) ;
                     if (!mij) continue ;
 
                     //----------------------------------------------------------
@@ -47,7 +47,7 @@
         Mp = M->p ;
         Mh = M->h ;
         Mi = M->i ;
-        Mx = M->x ;
+        Mx = (Mask_struct ? NULL : M->x) ;
         cast_M = GB_cast_factory (GB_BOOL_code, M->type->code) ;
         msize = M->type->size ;
     }
@@ -465,8 +465,7 @@
                     //----------------------------------------------------------
 
                     int64_t i = Mi [pM] ;
-                    bool mij ;
-                    cast_M (&mij, Mx +(pM*msize), 0) ;
+                    bool mij = GB_mcast (Mx, pM, msize, cast_M) ;
                     if (!mij) continue ;
 
                     //----------------------------------------------------------
@@ -86,7 +86,7 @@
         Mp = M->p ;
         // Mh = M->h ;
         Mi = M->i ;
-        Mx = M->x ;
+        Mx = (Mask_struct ? NULL : M->x) ;
         cast_M = GB_cast_factory (GB_BOOL_code, M->type->code) ;
         msize = M->type->size ;
         // Mnvec = M->nvec ;
@@ -328,7 +328,7 @@
                     bool mij = false ;
                     if (i == iM)
                     { 
-                        cast_M (&mij, Mx +(pM*msize), 0) ;
+                        mij = GB_mcast (Mx, pM, msize, cast_M) ;
                         pM++ ;
                     }
                     if (Mask_comp) mij = !mij ;
@@ -375,7 +375,7 @@
                     GB_BINARY_SPLIT_SEARCH (i, Mi, pM, pright, found) ;
                     if (found)
                     {
-                        cast_M (&mij, Mx +(pM*msize), 0) ;
+                        mij = GB_mcast (Mx, pM, msize, cast_M) ;
                         // increment pM for the wrapup phase below
                         pM++ ;
                     }
@@ -447,8 +447,7 @@
 
                             for ( ; pM < pM_end ; pM++)
                             {
-                                bool mij ;
-                                cast_M (&mij, Mx +(pM*msize), 0) ;
+                                bool mij = GB_mcast (Mx, pM, msize, cast_M) ;
                                 if (mij)
                                 { 
                                     int64_t i = Mi [pM] ;
@@ -474,7 +473,10 @@
                                 int64_t pright = pM_end - 1 ;
                                 bool found ;
                                 GB_BINARY_SEARCH (i, Mi, pM, pright, found) ;
-                                if (found) cast_M (&mij, Mx +(pM*msize), 0) ;
+                                if (found)
+                                { 
+                                    mij = GB_mcast (Mx, pM, msize, cast_M) ;
+                                }
                                 if (mij) GB_COPY_Z ;
                             }
 
@@ -504,7 +506,7 @@
                                 { 
                                     // both M(i,j) and Z(i,j) exist
                                     bool mij ;
-                                    cast_M (&mij, Mx +(pM*msize), 0) ;
+                                    mij = GB_mcast (Mx, pM, msize, cast_M) ;
                                     if (mij) GB_COPY_Z ;
                                     pM++ ;
                                     pZ++ ;
@@ -527,7 +529,7 @@
                             int64_t pright = pM_end - 1 ;
                             bool found ;
                             GB_BINARY_SEARCH (i, Mi, pM, pright, found) ;
-                            if (found) cast_M (&mij, Mx +(pM*msize), 0) ;
+                            if (found) mij = GB_mcast (Mx, pM, msize, cast_M) ;
                             if (!mij) GB_COPY_Z ;   // mask is complemented
                         }
                     }
@@ -556,8 +558,7 @@
 
                             for ( ; pM < pM_end ; pM++)
                             {
-                                bool mij ;
-                                cast_M (&mij, Mx +(pM*msize), 0) ;
+                                bool mij = GB_mcast (Mx, pM, msize, cast_M) ;
                                 if (mij)
                                 { 
                                     int64_t i = Mi [pM] ;
@@ -583,7 +584,10 @@
                                 int64_t pright = pM_end - 1 ;
                                 bool found ;
                                 GB_BINARY_SEARCH (i, Mi, pM, pright, found) ;
-                                if (found) cast_M (&mij, Mx +(pM*msize), 0) ;
+                                if (found)
+                                { 
+                                    mij = GB_mcast (Mx, pM, msize, cast_M) ;
+                                }
                                 if (mij) GB_COPY_C ;
                             }
 
@@ -613,7 +617,7 @@
                                 { 
                                     // both M(i,j) and C(i,j) exist
                                     bool mij ;
-                                    cast_M (&mij, Mx +(pM*msize), 0) ;
+                                    mij = GB_mcast (Mx, pM, msize, cast_M) ;
                                     if (mij) GB_COPY_C ;
                                     pM++ ;
                                     pC++ ;
@@ -636,7 +640,7 @@
                             int64_t pright = pM_end - 1 ;
                             bool found ;
                             GB_BINARY_SEARCH (i, Mi, pM, pright, found) ;
-                            if (found) cast_M (&mij, Mx +(pM*msize), 0) ;
+                            if (found) mij = GB_mcast (Mx, pM, msize, cast_M) ;
                             if (!mij) GB_COPY_C ;
                         }
                     }
@@ -355,10 +355,12 @@ GrB_Desc_Value AxB_method_used ;    // last method used for C=A*B (this is C)
 
 // The GrB_wait function tells GraphBLAS to finish all pending computations on
 // all matrices.  The function takes no arguments, so a list must be
-// maintained.  The list is implemented as a simple doubly-linked list.  All
-// matrices with either pending tuples, or zombies, or both, appear in this
-// list.  If a matrix has neither pending tuples nor zombies, then it does not
-// appear in this list.
+// maintained.  The list is split into GB_QUEUE_NSHARDS doubly-linked lists,
+// each with its own lock, and a matrix is placed in the shard selected by a
+// hash of its address.  All matrices with either pending tuples, or zombies,
+// or both, appear in this list.  A matrix whose pending work has been
+// finished may still appear in the list, until GrB_wait removes it or it is
+// freed.
 
 void *queue_next ;      // next matrix in the matrix queue
 void *queue_prev ;      // prev matrix in the matrix queue
@@ -384,6 +386,24 @@ bool h_shallow ;        // true if h is a shallow copy
 bool i_shallow ;        // true if i is a shallow copy
 bool x_shallow ;        // true if x is a shallow copy
 
+//------------------------------------------------------------------------------
+// views: triangular parts of another matrix, with no copy of its entries
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_tri_view returns a "view" to the user application: a matrix
+// whose A->i and A->x are shallow pointers into another matrix, and whose
+// vectors need not be contiguous.  The kth vector of a view is held in
+// Ai [Ap [k] ... Ae [k]-1] and Ax [Ap [k] ... Ae [k]-1], where Ae = A->e.
+// Ap [0] need not be zero, and Ap [nvec] is set to Ap [0] + (the number of
+// entries in the view), so that GB_NNZ (A) is still correct.  A->p, A->h,
+// and A->e are not shallow, so a view takes O(n) memory, not O(nnz).
+
+// Only GB_AxB_dot3 (via GB_mxm) and GB_reduce_to_scalar access a view
+// directly.  GB_wait copies a view into a standard matrix, so all other
+// methods see a view as a matrix with pending work, finished by GB_WAIT.
+
+int64_t *e ;            // if not NULL, A is a view; size plen+1
+
 //------------------------------------------------------------------------------
 // other bool content
 //------------------------------------------------------------------------------
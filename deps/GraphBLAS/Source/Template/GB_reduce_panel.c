@@ -8,7 +8,8 @@
 //------------------------------------------------------------------------------
 
 // Reduce a matrix to a scalar using a panel-based method for built-in
-// operators.  No typecasting is performed.
+// operators.  No typecasting is performed.  On input, s is the identity
+// value of the monoid.
 
 {
 
@@ -16,7 +17,46 @@
     int64_t anz = GB_NNZ (A) ;
     ASSERT (anz > 0) ;
 
-    if (nthreads == 1)
+    if (GB_IS_VIEW (A))
+    {
+
+        //----------------------------------------------------------------------
+        // A is a view: reduce each vector in Ax [Ap [k] ... Ae [k]-1]
+        //----------------------------------------------------------------------
+
+        // The vectors of a view are not contiguous, so no panel is used.
+        // Each task reduces a set of whole vectors, starting with the identity.
+
+        const int64_t *restrict Ap = A->p ;
+        const int64_t *restrict Ae = A->e ;
+        const int64_t anvec = A->nvec ;
+        GB_CTYPE W [ntasks] ;
+
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, anvec, tid, ntasks) ;
+            GB_ATYPE t = s ;
+            for (int64_t k = kstart ; k < kend ; k++)
+            {
+                for (int64_t p = Ap [k] ; p < Ae [k] ; p++)
+                { 
+                    // t = op (t, Ax [p]) ;
+                    GB_ADD_ARRAY_TO_SCALAR (t, Ax, p) ;
+                }
+            }
+            W [tid] = t ;
+        }
+
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        { 
+            // s = op (s, W [tid]), no typecast
+            GB_ADD_ARRAY_TO_SCALAR (s, W, tid) ;
+        }
+
+    }
+    else if (nthreads == 1)
     {
 
         //----------------------------------------------------------------------
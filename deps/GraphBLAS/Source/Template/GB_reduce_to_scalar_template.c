@@ -16,7 +16,51 @@
     int64_t anz = GB_NNZ (A) ;
     ASSERT (anz > 0) ;
 
-    if (nthreads == 1)
+    if (GB_IS_VIEW (A))
+    {
+
+        //----------------------------------------------------------------------
+        // A is a view: reduce each vector in Ax [Ap [k] ... Ae [k]-1]
+        //----------------------------------------------------------------------
+
+        // Each task reduces a set of whole vectors, starting with the identity.
+
+        const int64_t *restrict Ap = A->p ;
+        const int64_t *restrict Ae = A->e ;
+        const int64_t anvec = A->nvec ;
+
+        // ztype W [ntasks] ;
+        GB_REDUCTION_WORKSPACE (W, ntasks) ;
+
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        {
+            GB_TRACE_BEGIN ("reduce task") ;
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, anvec, tid, ntasks) ;
+            // ztype t = identity
+            GB_SCALAR_IDENTITY (t) ;
+            for (int64_t k = kstart ; k < kend ; k++)
+            {
+                for (int64_t p = Ap [k] ; p < Ae [k] ; p++)
+                { 
+                    // t = op (t, (ztype) Ax [p]), with typecast
+                    GB_ADD_CAST_ARRAY_TO_SCALAR (t, Ax, p) ;
+                }
+            }
+            // W [tid] = t, no typecast
+            GB_COPY_SCALAR_TO_ARRAY (W, tid, t) ;
+            GB_TRACE_END ("reduce task") ;
+        }
+
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        { 
+            // s = op (s, W [tid]), no typecast
+            GB_ADD_ARRAY_TO_SCALAR (s, W, tid) ;
+        }
+
+    }
+    else if (nthreads == 1)
     {
 
         //----------------------------------------------------------------------
@@ -53,6 +97,7 @@
         #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
         for (int tid = 0 ; tid < ntasks ; tid++)
         {
+            GB_TRACE_BEGIN ("reduce task") ;
             int64_t pstart, pend ;
             GB_PARTITION (pstart, pend, anz, tid, ntasks) ;
             // ztype t = (ztype) Ax [pstart], with typecast
@@ -70,6 +115,7 @@
             }
             // W [tid] = t, no typecast
             GB_COPY_SCALAR_TO_ARRAY (W, tid, t) ;
+            GB_TRACE_END ("reduce task") ;
         }
 
         //----------------------------------------------------------------------
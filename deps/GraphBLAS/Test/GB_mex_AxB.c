@@ -71,6 +71,7 @@ GrB_Info axb (GB_Context Context)
         NULL,       // no MT returned
         NULL,       // no Mask
         false,      // mask not complemented
+        false,      // mask not structural
         A, B,
         semiring,   // GrB_PLUS_TIMES_FP64
         atranspose,
@@ -150,6 +151,7 @@ GrB_Info axb_complex (GB_Context Context)
         NULL,       // no MT returned
         NULL,       // no Mask
         false,      // mask not complemented
+        false,      // mask not structural
         (atranspose) ? Aconj : A,
         (btranspose) ? Bconj : B,
         #ifdef MY_COMPLEX
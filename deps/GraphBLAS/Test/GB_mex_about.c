@@ -893,6 +893,7 @@ void mexFunction
     GB_slice_vector (&i, NULL, &pA, &pB,
         0, 0, NULL,     // Mi is empty
         0, 10, NULL, 1, // Ah is an implicit hyperlist: [1 2 3 4 5 6 7 8 9 10]
+        0,              // A has no zombies
         0, 10, Bh,      // Bh is an explicit hyperlist
         2001,           // n
         (double) 10) ;  // target_work
@@ -1984,7 +1984,7 @@ void mexFunction
     bool mask_applied = false ;
     GrB_Matrix Aslice [1] ;
     Aslice [0] = HugeRow ;
-    OK (GB_AxB_dot2 (&HugeMatrix, NULL, Aslice, HugeRow,
+    OK (GB_AxB_dot2 (&HugeMatrix, NULL, false, Aslice, HugeRow,
         GxB_PLUS_TIMES_FP64, false, &mask_applied, 1, 1, 1, Context)) ;
 
     GxB_fprint (HugeMatrix, GB3, ff) ;
@@ -3941,7 +3941,10 @@ void mexFunction
     CHECK (A == NULL) ;
 
     OK (GrB_wait ( )) ;
-    CHECK (GB_Global_queue_head_get ( ) == NULL) ;
+    for (int s = 0 ; s < GB_QUEUE_NSHARDS ; s++)
+    {
+        CHECK (GB_Global_queue_head_get (s) == NULL) ;
+    }
 
     Context->where = "GB_Matrix_check" ;
 
@@ -4139,12 +4142,12 @@ void mexFunction
     AP->op = NULL ;
     OK (GB_Matrix_check (A, "valid pending [pi 7.1 11.4]", GB0, NULL, Context));
 
-    CHECK (GB_Global_queue_head_get ( ) == A) ;
-    GB_Global_queue_head_set (NULL) ;
+    CHECK (GB_Global_queue_head_get (GB_QUEUE_SHARD (A)) == A) ;
+    GB_Global_queue_head_set (GB_QUEUE_SHARD (A), NULL) ;
     ERR (GB_Matrix_check (A, "inconsistent queue", GB3, NULL, Context)) ;
     A->enqueued = false ;
     ERR (GB_Matrix_check (A, "missing from queue", GB3, NULL, Context)) ;
-    GB_Global_queue_head_set (A) ;
+    GB_Global_queue_head_set (GB_QUEUE_SHARD (A), A) ;
     A->enqueued = true ;
     OK (GB_Matrix_check (A, "valid pending [pi 7.1 11.4]", GB0, NULL,
         Context)) ;
@@ -4211,12 +4214,12 @@ void mexFunction
 
     expected = GrB_INVALID_OBJECT ;
 
-    CHECK (GB_Global_queue_head_get ( ) == NULL) ;
-    GB_Global_queue_head_set (A) ;
+    CHECK (GB_Global_queue_head_get (GB_QUEUE_SHARD (A)) == NULL) ;
+    GB_Global_queue_head_set (GB_QUEUE_SHARD (A), A) ;
     A->enqueued = true ;
-    ERR (GB_Matrix_check (A, "should not be in queue", GB3, NULL, Context)) ;
+    OK  (GB_Matrix_check (A, "in queue, no pending", GB3, NULL, Context)) ;
     OK  (GB_Matrix_check (A, "ignore queue", GB_FLIP (GB3), NULL, Context)) ;
-    GB_Global_queue_head_set (NULL) ;
+    GB_Global_queue_head_set (GB_QUEUE_SHARD (A), NULL) ;
     A->enqueued = false ;
     OK (GB_Matrix_check (A, "valid, no pending", GB3, NULL, Context)) ;
 
@@ -4416,7 +4419,10 @@ void mexFunction
     //--------------------------------------------------------------------------
 
     OK (GrB_wait ( )) ;
-    CHECK (GB_Global_queue_head_get ( ) == NULL) ;
+    for (int s = 0 ; s < GB_QUEUE_NSHARDS ; s++)
+    {
+        CHECK (GB_Global_queue_head_get (s) == NULL) ;
+    }
     OK (GrB_Matrix_setElement (A, 32.4, 3, 2)) ;
     OK (GB_Matrix_check (A, "A with one pending", GB3, NULL, Context)) ;
     AP = A->Pending ;
@@ -4509,7 +4515,8 @@ void mexFunction
     dgunk->out = 999 ;
     x_bool = false ;
     Context->where = "GB_Descriptor_get" ;
-    ERR (GB_Descriptor_get (dgunk, &x_bool, NULL, NULL, NULL, NULL, Context)) ;
+    ERR (GB_Descriptor_get (dgunk, &x_bool, NULL, NULL, NULL, NULL, NULL,
+        Context)) ;
     CHECK (x_bool == false) ;
     dgunk->out = GxB_DEFAULT ;
 
@@ -82,6 +82,7 @@ GrB_Info axb (GB_Context Context)
         NULL,       // no MT returned
         NULL,       // no Mask
         false,      // mask not complemented
+        false,      // mask not structural
         A, B,
         My_plus_rdiv2,
         atranspose,
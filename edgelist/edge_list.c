@@ -0,0 +1,99 @@
+// Edge list reader shared by ./main, its batch mode and tricount_bench.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "edge_list.h"
+
+#define MAX_ITEM_NAME_LEN 10
+#define MIN_TUPLE_CAPACITY 1024
+
+static bool grow_edges(edge_list* edges, size_t needed) {
+    if (needed <= edges->capacity) {
+        return true;
+    }
+
+    size_t capacity = edges->capacity < MIN_TUPLE_CAPACITY ? MIN_TUPLE_CAPACITY : edges->capacity;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+
+    GrB_Index* I = realloc(edges->I, capacity * sizeof(GrB_Index));
+    if (I == NULL) return false;
+    edges->I = I;
+    GrB_Index* J = realloc(edges->J, capacity * sizeof(GrB_Index));
+    if (J == NULL) return false;
+    edges->J = J;
+    uint32_t* X = realloc(edges->X, capacity * sizeof(uint32_t));
+    if (X == NULL) return false;
+    edges->X = X;
+
+    // every edge has the value 1
+    for (size_t k = edges->capacity; k < capacity; ++k) {
+        edges->X[k] = 1;
+    }
+    edges->capacity = capacity;
+    return true;
+}
+
+static void add_edge(edge_list* edges, GrB_Index v_id, GrB_Index to_id) {
+    edges->I[edges->nvals] = v_id;
+    edges->J[edges->nvals] = to_id;
+    edges->nvals++;
+}
+
+bool edge_list_read(edge_list* edges, const char* path, bool directed) {
+    edges->nvals = 0;
+    edges->n = 0;
+
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        return false;
+    }
+
+    bool ok = true;
+    while (ok && getline(&edges->line_buf, &edges->buf_size, f) != -1) {
+        char v[MAX_ITEM_NAME_LEN], to[MAX_ITEM_NAME_LEN];
+        if (sscanf(edges->line_buf, "%9s %9s", v, to) != 2) {
+            continue;
+        }
+
+        GrB_Index v_id = (uint32_t) atoll(v);
+        GrB_Index to_id = (uint32_t) atoll(to);
+
+        // the directed census is only defined for graphs without self-edges
+        if (directed && v_id == to_id) {
+            continue;
+        }
+
+        ok = grow_edges(edges, edges->nvals + 2);
+        if (!ok) break;
+
+        add_edge(edges, v_id, to_id);
+        if (!directed) {
+            add_edge(edges, to_id, v_id);
+        }
+        if (v_id >= edges->n) edges->n = v_id + 1;
+        if (to_id >= edges->n) edges->n = to_id + 1;
+    }
+    fclose(f);
+    return ok;
+}
+
+GrB_Info edge_list_build(GrB_Matrix graph, const edge_list* edges) {
+    GrB_Info info = GrB_Matrix_clear(graph);
+    if (info != GrB_SUCCESS) {
+        return info;
+    }
+    return GrB_Matrix_build(graph, edges->I, edges->J, edges->X, edges->nvals,
+        GrB_FIRST_UINT32);
+}
+
+void edge_list_free(edge_list* edges) {
+    free(edges->I);
+    free(edges->J);
+    free(edges->X);
+    free(edges->line_buf);
+    memset(edges, 0, sizeof(edge_list));
+}
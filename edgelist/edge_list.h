@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../deps/GraphBLAS/Demo/Include/demos.h"
+
+// Edge lists, the input format of ./main and tricount_bench: one edge per
+// line, as two vertex ids separated by white space.  Lines that are not two
+// ids (comments, for example) are skipped.
+//
+// A file is read into tuple buffers, which only grow, so that reading many
+// graphs into the same edge_list reuses them.  Reading is plain C, so it can
+// run on a thread of its own next to GraphBLAS calls; the matrix is built
+// from the tuples separately.
+
+typedef struct {
+    GrB_Index* I;       // tuples of the edges read
+    GrB_Index* J;
+    uint32_t* X;        // every edge has the value 1
+    size_t nvals;       // # of tuples read
+    size_t capacity;    // size of I, J and X
+    GrB_Index n;        // largest vertex id + 1
+    char* line_buf;     // getline buffer
+    size_t buf_size;
+} edge_list;
+
+// Read the edge list in path into edges, replacing the edges read before.
+// Every edge is stored in both directions, or only as given if directed, in
+// which case self-edges are dropped.  Returns false if the file cannot be
+// read or the buffers cannot grow.
+bool edge_list_read(edge_list* edges, const char* path, bool directed);
+
+// Replace the entries of graph with the edges.  The graph must be GrB_UINT32
+// and at least edges->n by edges->n.
+GrB_Info edge_list_build(GrB_Matrix graph, const edge_list* edges);
+
+void edge_list_free(edge_list* edges);
@@ -0,0 +1,103 @@
+// Write a synthetic graph as an edge list.
+//
+// The graph is generated with the gen_graph spec (see graph_gen.h) and
+// written with one "i j" line per undirected edge, i < j, the input format of
+// ./main and tricount_bench.  The number of nodes, edges and, for the graphs
+// where it is known in closed form, triangles are reported on stderr.
+//
+// Usage: ./gengraph [-x seed] spec [edges.txt]
+//
+// tricount_bench also takes "gen:spec" in place of a file, which builds the
+// graph in memory and skips the edge list.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graph_gen.h"
+#include "../timer/simple_timer.h"
+
+static GrB_Info write_edges(FILE* f, GrB_Matrix graph) {
+    GrB_Index nvals;
+    GrB_Info info = GrB_Matrix_nvals(&nvals, graph);
+    if (info != GrB_SUCCESS) {
+        return info;
+    }
+    GrB_Index* I = malloc((nvals + 1) * sizeof(GrB_Index));
+    GrB_Index* J = malloc((nvals + 1) * sizeof(GrB_Index));
+    if (I == NULL || J == NULL) {
+        info = GrB_OUT_OF_MEMORY;
+    } else {
+        info = GrB_Matrix_extractTuples_UINT32(I, J, NULL, &nvals, graph);
+    }
+    for (GrB_Index k = 0; info == GrB_SUCCESS && k < nvals; ++k) {
+        if (I[k] < J[k]) {
+            fprintf(f, "%lu %lu\n", I[k], J[k]);
+        }
+    }
+    free(I);
+    free(J);
+    return info;
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr, "usage: %s [-x seed] spec [edges.txt]\n"
+        "spec: rmat:SCALE:EDGE_FACTOR, er:N:DEGREE, complete:N, grid:ROWS:COLS,\n"
+        "      powerlaw:N:DEGREE:EXPONENT, kron:K:POWER\n", prog);
+}
+
+int main(int argc, char* argv[]) {
+    uint64_t seed = GEN_DEFAULT_SEED;
+    int arg = 1;
+    if (arg + 1 < argc && strcmp(argv[arg], "-x") == 0) {
+        seed = strtoull(argv[arg + 1], NULL, 10);
+        arg += 2;
+    }
+    if (arg == argc || arg + 2 < argc) {
+        usage(argv[0]);
+        return 1;
+    }
+    const char* spec = argv[arg];
+    const char* path = (arg + 1 < argc) ? argv[arg + 1] : NULL;
+
+    GrB_init(GrB_NONBLOCKING);
+
+    GrB_Matrix graph = NULL;
+    double tic[2];
+    simple_tic(tic);
+    GrB_Info info = gen_graph(&graph, spec, seed);
+    double time = simple_toc(tic);
+    if (info == GrB_INVALID_VALUE) {
+        fprintf(stderr, "invalid graph spec %s\n", spec);
+        usage(argv[0]);
+        GrB_finalize();
+        return 1;
+    }
+    if (info != GrB_SUCCESS) {
+        fprintf(stderr, "cannot generate %s: %d\n", spec, info);
+        GrB_finalize();
+        return 1;
+    }
+
+    GrB_Index n, nvals;
+    GrB_Matrix_nrows(&n, graph);
+    GrB_Matrix_nvals(&nvals, graph);
+    fprintf(stderr, "%s: %lu nodes, %lu edges, generated in %f s\n", spec, n, nvals / 2, time);
+    int64_t ntri = gen_known_triangles(spec);
+    if (ntri >= 0) {
+        fprintf(stderr, "%s: %ld triangles\n", spec, ntri);
+    }
+
+    FILE* f = (path == NULL) ? stdout : fopen(path, "w");
+    if (f == NULL) {
+        fprintf(stderr, "cannot open %s\n", path);
+        info = GrB_INVALID_VALUE;
+    } else {
+        info = write_edges(f, graph);
+        if (f != stdout) fclose(f);
+    }
+
+    GrB_free(&graph);
+    GrB_finalize();
+    return info == GrB_SUCCESS ? 0 : 1;
+}
@@ -0,0 +1,357 @@
+// Synthetic graph generators.
+//
+// The random generators write both directions of every edge into tuple
+// arrays in parallel, each edge drawn from its own random stream, and
+// GrB_Matrix_build merges the duplicate edges.  The self-edges they draw are
+// removed afterwards with GxB_select.  The Kronecker graphs are powers of a
+// complete graph, computed with GxB_kron.
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graph_gen.h"
+
+// Graph500 R-MAT quadrant probabilities, d = 1 - a - b - c
+#define RMAT_A 0.57
+#define RMAT_B 0.19
+#define RMAT_C 0.19
+
+#define MAX_KIND_LEN 16
+#define MAX_GEN_ARGS 3
+#define MAX_RMAT_SCALE 40
+
+// Both directions of every edge: edge e is tuples 2e and 2e+1
+typedef struct {
+    GrB_Index* I;
+    GrB_Index* J;
+    GrB_Index ntuples;
+} tuples;
+
+static uint64_t splitmix64(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// The random stream of edge e, so that the graph does not depend on which
+// thread draws which edge
+static uint64_t edge_stream(uint64_t seed, uint64_t e) {
+    uint64_t state = seed ^ (e * 0xD1B54A32D192ED03ULL);
+    return splitmix64(&state);
+}
+
+static double uniform(uint64_t* state) {
+    return (splitmix64(state) >> 11) * 0x1.0p-53;
+}
+
+static bool alloc_tuples(tuples* t, GrB_Index nedges) {
+    t->ntuples = 2 * nedges;
+    t->I = malloc((t->ntuples + 1) * sizeof(GrB_Index));
+    t->J = malloc((t->ntuples + 1) * sizeof(GrB_Index));
+    if (t->I == NULL || t->J == NULL) {
+        free(t->I);
+        free(t->J);
+        return false;
+    }
+    return true;
+}
+
+static inline void set_edge(tuples* t, GrB_Index e, GrB_Index i, GrB_Index j) {
+    t->I[2 * e] = i;
+    t->J[2 * e] = j;
+    t->I[2 * e + 1] = j;
+    t->J[2 * e + 1] = i;
+}
+
+// Build the n-by-n graph from the tuples, which are freed
+static GrB_Info build_graph(GrB_Matrix* graph, GrB_Index n, tuples* t, bool self_edges) {
+    uint32_t* X = malloc((t->ntuples + 1) * sizeof(uint32_t));
+    GrB_Info info = (X == NULL) ? GrB_OUT_OF_MEMORY : GrB_SUCCESS;
+    if (info == GrB_SUCCESS) {
+        #pragma omp parallel for schedule(static)
+        for (GrB_Index k = 0; k < t->ntuples; ++k) {
+            X[k] = 1;
+        }
+        info = GrB_Matrix_new(graph, GrB_UINT32, n, n);
+    }
+    if (info == GrB_SUCCESS) {
+        info = GrB_Matrix_build(*graph, t->I, t->J, X, t->ntuples, GrB_FIRST_UINT32);
+    }
+    if (info == GrB_SUCCESS && self_edges) {
+        info = GxB_select(*graph, NULL, NULL, GxB_OFFDIAG, *graph, NULL, NULL);
+    }
+    free(X);
+    free(t->I);
+    free(t->J);
+    if (info != GrB_SUCCESS) {
+        GrB_free(graph);
+    }
+    return info;
+}
+
+static GrB_Info gen_rmat(GrB_Matrix* graph, int scale, GrB_Index edge_factor, uint64_t seed) {
+    GrB_Index n = (GrB_Index) 1 << scale;
+    GrB_Index nedges = n * edge_factor;
+    tuples t;
+    if (!alloc_tuples(&t, nedges)) {
+        return GrB_OUT_OF_MEMORY;
+    }
+
+    // every level of the recursion picks one quadrant of the adjacency matrix
+    #pragma omp parallel for schedule(static)
+    for (GrB_Index e = 0; e < nedges; ++e) {
+        uint64_t state = edge_stream(seed, e);
+        GrB_Index i = 0, j = 0;
+        for (int level = 0; level < scale; ++level) {
+            GrB_Index bit = (GrB_Index) 1 << (scale - 1 - level);
+            double u = uniform(&state);
+            if (u < RMAT_A) {
+                // top left
+            } else if (u < RMAT_A + RMAT_B) {
+                j |= bit;
+            } else if (u < RMAT_A + RMAT_B + RMAT_C) {
+                i |= bit;
+            } else {
+                i |= bit;
+                j |= bit;
+            }
+        }
+        set_edge(&t, e, i, j);
+    }
+    return build_graph(graph, n, &t, true);
+}
+
+static GrB_Info gen_erdos_renyi(GrB_Matrix* graph, GrB_Index n, double degree,
+    uint64_t seed) {
+    GrB_Index nedges = (GrB_Index) (n * degree / 2);
+    tuples t;
+    if (!alloc_tuples(&t, nedges)) {
+        return GrB_OUT_OF_MEMORY;
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (GrB_Index e = 0; e < nedges; ++e) {
+        uint64_t state = edge_stream(seed, e);
+        GrB_Index i = (GrB_Index) (uniform(&state) * n);
+        GrB_Index j = (GrB_Index) (uniform(&state) * n);
+        set_edge(&t, e, i, j);
+    }
+    return build_graph(graph, n, &t, true);
+}
+
+// First k with cdf [k] > u
+static GrB_Index search_cdf(const double* cdf, GrB_Index n, double u) {
+    GrB_Index lo = 0, hi = n - 1;
+    while (lo < hi) {
+        GrB_Index mid = lo + (hi - lo) / 2;
+        if (cdf[mid] > u) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+// Chung-Lu: both ends of an edge are drawn with probability proportional to
+// the weight (k+1)^(-1/(exponent-1)) of node k, which gives a power-law
+// degree distribution with the exponent
+static GrB_Info gen_powerlaw(GrB_Matrix* graph, GrB_Index n, double degree, double exponent,
+    uint64_t seed) {
+    double* cdf = malloc(n * sizeof(double));
+    if (cdf == NULL) {
+        return GrB_OUT_OF_MEMORY;
+    }
+    double total = 0;
+    for (GrB_Index k = 0; k < n; ++k) {
+        total += pow((double) (k + 1), -1 / (exponent - 1));
+        cdf[k] = total;
+    }
+    #pragma omp parallel for schedule(static)
+    for (GrB_Index k = 0; k < n; ++k) {
+        cdf[k] /= total;
+    }
+
+    GrB_Index nedges = (GrB_Index) (n * degree / 2);
+    tuples t;
+    if (!alloc_tuples(&t, nedges)) {
+        free(cdf);
+        return GrB_OUT_OF_MEMORY;
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (GrB_Index e = 0; e < nedges; ++e) {
+        uint64_t state = edge_stream(seed, e);
+        GrB_Index i = search_cdf(cdf, n, uniform(&state));
+        GrB_Index j = search_cdf(cdf, n, uniform(&state));
+        set_edge(&t, e, i, j);
+    }
+    free(cdf);
+    return build_graph(graph, n, &t, true);
+}
+
+static GrB_Info gen_complete(GrB_Matrix* graph, GrB_Index n) {
+    tuples t;
+    if (!alloc_tuples(&t, n * (n - 1) / 2)) {
+        return GrB_OUT_OF_MEMORY;
+    }
+
+    // row i holds the n-1 tuples (i,j), j != i
+    #pragma omp parallel for schedule(static)
+    for (GrB_Index i = 0; i < n; ++i) {
+        for (GrB_Index j = 0; j < n; ++j) {
+            if (j == i) {
+                continue;
+            }
+            GrB_Index k = i * (n - 1) + (j < i ? j : j - 1);
+            t.I[k] = i;
+            t.J[k] = j;
+        }
+    }
+    return build_graph(graph, n, &t, false);
+}
+
+static GrB_Info gen_grid(GrB_Matrix* graph, GrB_Index rows, GrB_Index cols) {
+    // the horizontal edges come first, then the vertical ones
+    GrB_Index nhorizontal = rows * (cols - 1);
+    tuples t;
+    if (!alloc_tuples(&t, nhorizontal + (rows - 1) * cols)) {
+        return GrB_OUT_OF_MEMORY;
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (GrB_Index v = 0; v < rows * cols; ++v) {
+        GrB_Index r = v / cols, c = v % cols;
+        if (c + 1 < cols) {
+            set_edge(&t, r * (cols - 1) + c, v, v + 1);
+        }
+        if (r + 1 < rows) {
+            set_edge(&t, nhorizontal + v, v, v + cols);
+        }
+    }
+    return build_graph(graph, rows * cols, &t, false);
+}
+
+// K_k (x) K_k (x) ... (x) K_k.  The Kronecker product of two graphs without
+// self-edges has none either.
+static GrB_Info gen_kronecker(GrB_Matrix* graph, GrB_Index k, int power) {
+    GrB_Matrix K = NULL;
+    GrB_Info info = gen_complete(&K, k);
+    if (info != GrB_SUCCESS) {
+        return info;
+    }
+    info = GrB_Matrix_dup(graph, K);
+    GrB_Index n = k;
+    for (int p = 1; p < power && info == GrB_SUCCESS; ++p) {
+        n *= k;
+        GrB_Matrix product = NULL;
+        info = GrB_Matrix_new(&product, GrB_UINT32, n, n);
+        if (info == GrB_SUCCESS) {
+            info = GxB_kron(product, NULL, NULL, GrB_TIMES_UINT32, *graph, K, NULL);
+        }
+        GrB_free(graph);
+        *graph = product;
+    }
+    GrB_free(&K);
+    if (info != GrB_SUCCESS) {
+        GrB_free(graph);
+    }
+    return info;
+}
+
+// Split "kind:a:b:c" into the kind and its numeric arguments.  Returns the
+// number of arguments, or -1 if the spec is malformed.
+static int parse_spec(const char* spec, char kind[MAX_KIND_LEN], double args[MAX_GEN_ARGS]) {
+    size_t len = strcspn(spec, ":");
+    if (len == 0 || len >= MAX_KIND_LEN) {
+        // the callers compare kind whatever the outcome
+        kind[0] = '\0';
+        return -1;
+    }
+    memcpy(kind, spec, len);
+    kind[len] = '\0';
+
+    int nargs = 0;
+    const char* s = spec + len;
+    while (*s == ':') {
+        if (nargs == MAX_GEN_ARGS) {
+            return -1;
+        }
+        char* end;
+        args[nargs++] = strtod(s + 1, &end);
+        if (end == s + 1) {
+            return -1;
+        }
+        s = end;
+    }
+    return *s == '\0' ? nargs : -1;
+}
+
+// a whole number of at least min
+static bool is_count(double x, double min) {
+    return x >= min && x == floor(x);
+}
+
+GrB_Info gen_graph(GrB_Matrix* graph, const char* spec, uint64_t seed) {
+    *graph = NULL;
+    char kind[MAX_KIND_LEN];
+    double a[MAX_GEN_ARGS];
+    int nargs = parse_spec(spec, kind, a);
+
+    if (strcmp(kind, "rmat") == 0 && nargs == 2 && is_count(a[0], 1)
+        && a[0] <= MAX_RMAT_SCALE && is_count(a[1], 1)) {
+        return gen_rmat(graph, (int) a[0], (GrB_Index) a[1], seed);
+    }
+    if (strcmp(kind, "er") == 0 && nargs == 2 && is_count(a[0], 2) && a[1] > 0) {
+        return gen_erdos_renyi(graph, (GrB_Index) a[0], a[1], seed);
+    }
+    if (strcmp(kind, "complete") == 0 && nargs == 1 && is_count(a[0], 2)) {
+        return gen_complete(graph, (GrB_Index) a[0]);
+    }
+    if (strcmp(kind, "grid") == 0 && nargs == 2 && is_count(a[0], 1) && is_count(a[1], 1)
+        && a[0] * a[1] >= 2) {
+        return gen_grid(graph, (GrB_Index) a[0], (GrB_Index) a[1]);
+    }
+    if (strcmp(kind, "powerlaw") == 0 && nargs == 3 && is_count(a[0], 2) && a[1] > 0
+        && a[2] > 1) {
+        return gen_powerlaw(graph, (GrB_Index) a[0], a[1], a[2], seed);
+    }
+    if (strcmp(kind, "kron") == 0 && nargs == 2 && is_count(a[0], 2) && is_count(a[1], 1)
+        && a[1] * log2(a[0]) <= 62) {
+        return gen_kronecker(graph, (GrB_Index) a[0], (int) a[1]);
+    }
+    return GrB_INVALID_VALUE;
+}
+
+int64_t gen_known_triangles(const char* spec) {
+    char kind[MAX_KIND_LEN];
+    double a[MAX_GEN_ARGS];
+    int nargs = parse_spec(spec, kind, a);
+
+    if (strcmp(kind, "grid") == 0 && nargs == 2) {
+        return 0;
+    }
+    if ((strcmp(kind, "complete") != 0 || nargs != 1)
+        && (strcmp(kind, "kron") != 0 || nargs != 2)) {
+        return -1;
+    }
+
+    // K_k has k choose 3 triangles
+    int64_t k = (int64_t) a[0];
+    int64_t triangles = k * (k - 1) * (k - 2) / 6;
+    if (strcmp(kind, "complete") == 0) {
+        return triangles;
+    }
+
+    // trace ((A (x) B)^3) = trace (A^3) trace (B^3) and a graph has
+    // trace (A^3) / 6 triangles, so t (A (x) B) = 6 t (A) t (B)
+    int64_t count = triangles;
+    for (int p = 1; p < (int) a[1]; ++p) {
+        if (__builtin_mul_overflow(count, 6 * triangles, &count)) {
+            return -1;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "../deps/GraphBLAS/Demo/Include/demos.h"
+
+// Synthetic graphs, built in parallel straight into a GrB_Matrix.
+//
+// A graph is described by a spec string:
+//
+//      rmat:SCALE:EDGE_FACTOR          R-MAT / Graph500, 2^SCALE nodes
+//      er:N:DEGREE                     Erdős–Rényi G(n, m), m = N*DEGREE/2
+//      complete:N                      complete graph K_N
+//      grid:ROWS:COLS                  2D grid, 4 neighbours per node
+//      powerlaw:N:DEGREE:EXPONENT      Chung-Lu graph, degrees ~ d^-EXPONENT
+//      kron:K:POWER                    K_K (x) K_K (x) ... POWER times
+//
+// Every graph is returned as a symmetric GrB_UINT32 adjacency matrix with
+// the value 1 on every edge and no self-edges, like the graphs ./main and
+// tricount_bench read from edge lists.  The random graphs depend only on the
+// seed, not on the number of threads.
+
+#define GEN_DEFAULT_SEED 1
+
+// Generate the graph of spec into a new matrix.  Returns GrB_INVALID_VALUE
+// if the spec is not valid.
+GrB_Info gen_graph(
+    GrB_Matrix* graph,          // the new adjacency matrix
+    const char* spec,           // graph description, see above
+    uint64_t seed               // seed of the random graphs
+);
+
+// Number of triangles of the graph of spec, if it is known in closed form
+// (complete, grid and kron graphs), or -1
+int64_t gen_known_triangles(const char* spec);
@@ -0,0 +1,348 @@
+// Kernel microbenchmarks: time single GraphBLAS kernels on synthetic inputs.
+//
+// tricount_bench times whole triangle counting methods, where a change to one
+// kernel is mixed with the transposes, selects, waits and reductions around
+// it.  This driver calls the internal kernels directly, on one synthetic
+// matrix A of controlled size, density and skew, so that a kernel-level
+// optimization can be measured on its own:
+//
+//      dot3        C<A> = A'*A         GB_AxB_dot3
+//      gustavson   C<A> = A*A          GB_AxB_Gustavson (sequential)
+//      heap        C<A> = A*A          GB_AxB_heap (sequential)
+//      select      C = tril (A,-1)     GB_selector
+//      reduce      s = sum (A)         GB_reduce_to_scalar
+//      build       A from its tuples   GB_builder
+//
+// A is the symmetric adjacency matrix of a random graph with n nodes and
+// about n*degree/2 edges, stored by column (the orientation the kernels work
+// in) and with no pending work.  Both ends of an edge are drawn as n*u^skew
+// for a uniform u in [0,1): skew 1 is an Erdős–Rényi graph, larger skews
+// crowd the edges onto the low vertex ids and give a few vertices a very high
+// degree.  Self-edges are dropped; duplicate edges are kept in the tuples, so
+// the build kernel also assembles duplicates.
+//
+// Each kernel is run warmup + reps times on the same inputs, and the
+// statistics of the timed runs are written as one JSON document on stdout,
+// in the format of tricount_bench.
+//
+// Usage: ./kernel_bench [-n nodes] [-d degree] [-s skew] [-x seed]
+//                       [-w warmup] [-r reps] [-k kernel,...]
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GB_mxm.h"
+#include "GB_select.h"
+#include "GB_reduce.h"
+#include "GB_build.h"
+#include "GB_Sauna.h"
+
+#include "../bench/stats.h"
+#include "../timer/simple_timer.h"
+
+#define DEFAULT_NODES 100000
+#define DEFAULT_DEGREE 16
+#define DEFAULT_SKEW 1.0
+#define DEFAULT_SEED 1
+#define DEFAULT_WARMUP 1
+#define DEFAULT_REPS 5
+
+// The synthetic input of all kernels
+typedef struct {
+    GrB_Index n;
+    int64_t* I;             // tuples of A, both directions of every edge
+    int64_t* J;
+    int64_t* X;
+    GrB_Index ntuples;
+    GrB_Matrix A;           // built from the tuples, by column
+    int64_t bjnz_max;       // most entries in a column of A, for the heap
+} kernel_input;
+
+typedef GrB_Info (*kernel_fn)(const kernel_input* in);
+
+typedef struct {
+    const char* name;
+    kernel_fn run;
+} kernel;
+
+// The mxm kernels count triangles the way the methods do, with a mask
+static GrB_Info run_dot3(const kernel_input* in) {
+    GB_WHERE("kernel_bench dot3");
+    GrB_Matrix C = NULL;
+    GrB_Info info = GB_AxB_dot3(&C, in->A, false, in->A, in->A, GxB_PLUS_TIMES_INT64,
+        false, Context);
+    GrB_free(&C);
+    return info;
+}
+
+static GrB_Info run_gustavson(const kernel_input* in) {
+    GB_WHERE("kernel_bench gustavson");
+    // the Sauna is acquired as GB_AxB_saxpy_parallel does, inside the timing
+    int Sauna_id = -2;
+    GrB_Desc_Value method = GxB_AxB_GUSTAVSON;
+    GrB_Info info = GB_Sauna_acquire(1, &Sauna_id, &method, Context);
+    if (info != GrB_SUCCESS) {
+        return info;
+    }
+    if (method != GxB_AxB_GUSTAVSON) {
+        // all Saunas are in use: GraphBLAS would fall back to the heap
+        return GrB_OUT_OF_MEMORY;
+    }
+    GrB_Matrix C = NULL;
+    bool mask_applied = false;
+    info = GB_AxB_Gustavson(&C, in->A, false, false, in->A, in->A, GxB_PLUS_TIMES_INT64,
+        false, &mask_applied, Sauna_id);
+    GrB_free(&C);
+    GrB_Info release = GB_Sauna_release(1, &Sauna_id);
+    return info != GrB_SUCCESS ? info : release;
+}
+
+static GrB_Info run_heap(const kernel_input* in) {
+    GrB_Matrix C = NULL;
+    bool mask_applied = false;
+    GrB_Info info = GB_AxB_heap(&C, in->A, false, false, in->A, in->A, GxB_PLUS_TIMES_INT64,
+        false, &mask_applied, in->bjnz_max);
+    GrB_free(&C);
+    return info;
+}
+
+static GrB_Info run_select(const kernel_input* in) {
+    GB_WHERE("kernel_bench select");
+    GrB_Matrix C = NULL;
+    GrB_Info info = GB_selector(&C, GB_TRIL_opcode, GxB_TRIL, false, in->A, -1, NULL,
+        Context);
+    GrB_free(&C);
+    return info;
+}
+
+static GrB_Info run_reduce(const kernel_input* in) {
+    GB_WHERE("kernel_bench reduce");
+    int64_t sum = 0;
+    return GB_reduce_to_scalar(&sum, GrB_INT64, NULL, GxB_PLUS_INT64_MONOID, in->A, Context);
+}
+
+static GrB_Info run_build(const kernel_input* in) {
+    GB_WHERE("kernel_bench build");
+    // no workspace is passed in, so the tuples are copied and checked, as
+    // for GrB_Matrix_build
+    int64_t* no_I_work = NULL;
+    int64_t* no_J_work = NULL;
+    GB_void* no_S_work = NULL;
+    GrB_Matrix T = NULL;
+    GrB_Info info = GB_builder(&T, GrB_INT64, in->n, in->n, true, &no_I_work, &no_J_work,
+        &no_S_work, false, false, 0, true, true, in->I, in->J, (GB_void*) in->X,
+        in->ntuples, GrB_PLUS_INT64, GB_INT64_code, Context);
+    GrB_free(&T);
+    return info;
+}
+
+#define NKERNELS 6
+
+static const kernel KERNELS[NKERNELS] = {
+    {"dot3", run_dot3},
+    {"gustavson", run_gustavson},
+    {"heap", run_heap},
+    {"select", run_select},
+    {"reduce", run_reduce},
+    {"build", run_build}
+};
+
+// splitmix64, so that a seed gives the same graph everywhere
+static uint64_t next_random(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static int64_t random_node(uint64_t* state, GrB_Index n, double skew) {
+    double u = (next_random(state) >> 11) * 0x1.0p-53;
+    int64_t i = (int64_t) (n * pow(u, skew));
+    return i < (int64_t) n ? i : (int64_t) n - 1;
+}
+
+static void free_input(kernel_input* in) {
+    free(in->I);
+    free(in->J);
+    free(in->X);
+    GrB_free(&in->A);
+}
+
+static GrB_Info make_input(kernel_input* in, GrB_Index n, double degree, double skew,
+    uint64_t seed) {
+    memset(in, 0, sizeof(kernel_input));
+    in->n = n;
+    GrB_Index nedges = (GrB_Index) (n * degree / 2);
+    in->I = malloc(2 * nedges * sizeof(int64_t));
+    in->J = malloc(2 * nedges * sizeof(int64_t));
+    in->X = malloc(2 * nedges * sizeof(int64_t));
+    if (in->I == NULL || in->J == NULL || in->X == NULL) {
+        free_input(in);
+        return GrB_OUT_OF_MEMORY;
+    }
+
+    uint64_t state = seed;
+    for (GrB_Index e = 0; e < nedges; ++e) {
+        int64_t i = random_node(&state, n, skew);
+        int64_t j = random_node(&state, n, skew);
+        if (i == j) {
+            continue;
+        }
+        in->I[in->ntuples] = i;
+        in->J[in->ntuples] = j;
+        in->X[in->ntuples++] = 1;
+        in->I[in->ntuples] = j;
+        in->J[in->ntuples] = i;
+        in->X[in->ntuples++] = 1;
+    }
+
+    GrB_Info info = GrB_Matrix_new(&in->A, GrB_INT64, n, n);
+    if (info == GrB_SUCCESS) info = GxB_set(in->A, GxB_FORMAT, GxB_BY_COL);
+    if (info == GrB_SUCCESS) {
+        info = GrB_Matrix_build(in->A, (GrB_Index*) in->I, (GrB_Index*) in->J, in->X,
+            in->ntuples, GrB_FIRST_INT64);
+    }
+    GrB_Index nvals;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_nvals(&nvals, in->A);
+    if (info != GrB_SUCCESS) {
+        free_input(in);
+        return info;
+    }
+
+    const GrB_Matrix A = in->A;
+    for (int64_t k = 0; k < A->nvec; ++k) {
+        int64_t ajnz = A->p[k + 1] - A->p[k];
+        if (ajnz > in->bjnz_max) in->bjnz_max = ajnz;
+    }
+    return GrB_SUCCESS;
+}
+
+// Run one kernel warmup + reps times and write its JSON statistics
+static void bench_kernel(const kernel* k, const kernel_input* in, int warmup, int reps,
+    double* samples) {
+    GrB_Info info = GrB_SUCCESS;
+    for (int run = 0; run < warmup + reps && info == GrB_SUCCESS; ++run) {
+        double tic[2];
+        simple_tic(tic);
+        info = k->run(in);
+        double t = simple_toc(tic);
+        if (run >= warmup) {
+            samples[run - warmup] = t;
+        }
+    }
+    if (info != GrB_SUCCESS) {
+        printf("{\"error\": %d}", info);
+        return;
+    }
+    bench_stats stats;
+    bench_stats_compute(&stats, samples, reps);
+    bench_stats_print_json(stdout, &stats);
+}
+
+// Select the kernels in a comma separated list of names
+static bool parse_kernels(bool* selected, char* list) {
+    memset(selected, 0, NKERNELS * sizeof(bool));
+    for (char* name = strtok(list, ","); name != NULL; name = strtok(NULL, ",")) {
+        int i = 0;
+        while (i < NKERNELS && strcmp(name, KERNELS[i].name) != 0) {
+            ++i;
+        }
+        if (i == NKERNELS) {
+            fprintf(stderr, "unknown kernel %s\n", name);
+            return false;
+        }
+        selected[i] = true;
+    }
+    return true;
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr, "usage: %s [-n nodes] [-d degree] [-s skew] [-x seed] "
+        "[-w warmup] [-r reps] [-k kernel,...]\n", prog);
+}
+
+int main(int argc, char* argv[]) {
+    GrB_Index n = DEFAULT_NODES;
+    double degree = DEFAULT_DEGREE;
+    double skew = DEFAULT_SKEW;
+    uint64_t seed = DEFAULT_SEED;
+    int warmup = DEFAULT_WARMUP;
+    int reps = DEFAULT_REPS;
+    bool selected[NKERNELS];
+    for (int i = 0; i < NKERNELS; ++i) {
+        selected[i] = true;
+    }
+
+    int arg = 1;
+    while (arg < argc) {
+        if (argv[arg][0] != '-' || arg + 1 == argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        if (strcmp(argv[arg], "-n") == 0) {
+            n = strtoull(argv[arg + 1], NULL, 10);
+        } else if (strcmp(argv[arg], "-d") == 0) {
+            degree = atof(argv[arg + 1]);
+        } else if (strcmp(argv[arg], "-s") == 0) {
+            skew = atof(argv[arg + 1]);
+        } else if (strcmp(argv[arg], "-x") == 0) {
+            seed = strtoull(argv[arg + 1], NULL, 10);
+        } else if (strcmp(argv[arg], "-w") == 0) {
+            warmup = atoi(argv[arg + 1]);
+        } else if (strcmp(argv[arg], "-r") == 0) {
+            reps = atoi(argv[arg + 1]);
+        } else if (strcmp(argv[arg], "-k") == 0) {
+            if (!parse_kernels(selected, argv[arg + 1])) return 1;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+        arg += 2;
+    }
+    if (n < 2 || degree <= 0 || skew <= 0 || warmup < 0 || reps < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    GrB_init(GrB_NONBLOCKING);
+
+    kernel_input in;
+    GrB_Info info = make_input(&in, n, degree, skew, seed);
+    if (info != GrB_SUCCESS) {
+        fprintf(stderr, "cannot create the input: %d\n", info);
+        GrB_finalize();
+        return 1;
+    }
+
+    int nthreads;
+    GxB_get(GxB_NTHREADS, &nthreads);
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, in.A);
+    printf("{\"nodes\": %lu, \"degree\": %g, \"skew\": %g, \"seed\": %lu, "
+        "\"tuples\": %lu, \"nvals\": %lu, \"max_degree\": %ld, \"nthreads\": %d, "
+        "\"warmup\": %d, \"reps\": %d, \"kernels\": {",
+        n, degree, skew, seed, in.ntuples, nvals, in.bjnz_max, nthreads, warmup, reps);
+
+    double* samples = malloc(reps * sizeof(double));
+    assert(samples != NULL);
+    bool first = true;
+    for (int i = 0; i < NKERNELS; ++i) {
+        if (!selected[i]) {
+            continue;
+        }
+        fprintf(stderr, "    %s\n", KERNELS[i].name);
+        printf("%s\n    \"%s\": ", first ? "" : ",", KERNELS[i].name);
+        bench_kernel(&KERNELS[i], &in, warmup, reps, samples);
+        first = false;
+        fflush(stdout);
+    }
+    printf("\n}}\n");
+
+    free(samples);
+    free_input(&in);
+    GrB_finalize();
+    return 0;
+}
@@ -1,15 +1,20 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "deps/GraphBLAS/Include/GraphBLAS.h"
+#include "batch/batch.h"
+#include "edgelist/edge_list.h"
 #include "mytricount/mytricount.h"
 #include "timer/simple_timer.h"
 
 #define MAX_GRAPH_SIZE 2000000
-#define MAX_ITEM_NAME_LEN 10
+#define HUGE_PAGE_THRESHOLD ((int64_t) 64 << 20)
 
 char GRAPH_INPUT_FILE[255];
+bool DIRECTED = false; // keep edge directions and run the directed census
+int CLIQUE_SIZE = 0;   // also count the k-cliques of this size, if not 0
 
 char METHODS[][255] = {
     "Naive",
@@ -18,42 +23,79 @@ char METHODS[][255] = {
     "Sandia",
     "Sandia2",
     "SandiaDot",
-    "SandiaDot2"
+    "SandiaDot2",
+    "Forward"
 };
 
-GrB_Info info; // Log of GraphBLAS operations
-
-void load_graph(GrB_Matrix* graph, FILE* f) {
-    char* line_buf;
-    size_t buf_size = 0;
-
-    while (getline(&line_buf, &buf_size, f) != -1) {
-        line_buf[strcspn(line_buf, "\n")] = 0;
+#define NMETHODS (sizeof (METHODS) / sizeof (METHODS [0]))
 
-        char v[MAX_ITEM_NAME_LEN], to[MAX_ITEM_NAME_LEN];
-        int nitems = sscanf(line_buf, "%s %s", v, to);
-        assert(nitems == 2);
+GrB_Info info; // Log of GraphBLAS operations
 
-        uint32_t v_id = atoll(v);
-        uint32_t to_id = atoll(to);
+void run_census(GrB_Matrix graph) {
+    int64_t census[TRI_CENSUS_NTYPES];
+    double tic[2];
 
-        info = GrB_Matrix_setElement(*graph, 1, v_id, to_id);
-        assert(info == GrB_SUCCESS && "GraphBlas: failed to set matrix element (v, to)\n");
+    simple_tic(tic);
+    info = tri_census(census, graph);
+    assert(info == GrB_SUCCESS && "GraphBlas: failed to compute triangle census\n");
+    double time = simple_toc(tic);
 
-        info = GrB_Matrix_setElement(*graph, 1, to_id, v_id);  
-        assert(info == GrB_SUCCESS && "GraphBlas: failed to set matrix element (to, v)\n");      
+    int64_t total = 0;
+    for (int t = 0; t < TRI_CENSUS_NTYPES; ++t) {
+        printf("%s number of triangles in graph = %ld\n", tri_census_names[t], census[t]);
+        total += census[t];
     }
+    printf("Total number of triangles in graph = %ld\n", total);
+    printf("Census used time (in seconds): %f\n\n", time);
+    fflush(NULL);
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr, "usage: %s [-d] [-k k] graph\n       %s -m manifest\n", prog, prog);
 }
 
 int main(int argc, char* argv[]) {
-    // Load input path from command line
-    if (argc == 2) {
-        strcpy(GRAPH_INPUT_FILE, argv[1]);
-        printf("Input: %s\n", GRAPH_INPUT_FILE);
+    // Batch mode: ./main -m manifest
+    if (argc == 3 && strcmp(argv[1], "-m") == 0) {
+        GrB_init(GrB_NONBLOCKING);
+        GxB_set(GxB_ARENA, true);
+        GxB_set(GxB_HUGE_PAGES, HUGE_PAGE_THRESHOLD);
+        return run_batch(argv[2], METHODS, NMETHODS, MAX_GRAPH_SIZE);
+    }
+
+    // Load input path from command line: ./main [-d] [-k k] file
+    int arg = 1;
+    while (arg < argc && argv[arg][0] == '-') {
+        if (strcmp(argv[arg], "-d") == 0) {
+            DIRECTED = true;
+            ++arg;
+        } else if (strcmp(argv[arg], "-k") == 0) {
+            if (arg + 1 == argc) {
+                usage(argv[0]);
+                return 1;
+            }
+            CLIQUE_SIZE = atoi(argv[arg + 1]);
+            arg += 2;
+        } else {
+            break;
+        }
+    }
+    if (arg == argc) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (CLIQUE_SIZE != 0 && CLIQUE_SIZE < 2) {
+        fprintf(stderr, "the clique size must be at least 2\n");
+        return 1;
     }
+    strcpy(GRAPH_INPUT_FILE, argv[arg]);
+    printf("Input: %s\n", GRAPH_INPUT_FILE);
 
-    // Initialize GraphBLAS
+    // Initialize GraphBLAS, taking per-operation workspace from an arena
+    // and putting arrays of at least 64MB on huge pages
     GrB_init(GrB_NONBLOCKING);
+    GxB_set(GxB_ARENA, true);
+    GxB_set(GxB_HUGE_PAGES, HUGE_PAGE_THRESHOLD);
 
     // Create graph
     GrB_Matrix graph;
@@ -64,25 +106,64 @@ int main(int argc, char* argv[]) {
         );
     assert(info == GrB_SUCCESS && "GraphBlas: failed to construct matrix\n");
 
-    // Open file
-    FILE* f = fopen(GRAPH_INPUT_FILE, "r");
-    assert(f != NULL);
-
     // Load graph
-    load_graph(&graph, f);
-    fclose(f);
+    edge_list edges;
+    memset(&edges, 0, sizeof(edges));
+    bool loaded = edge_list_read(&edges, GRAPH_INPUT_FILE, DIRECTED);
+    assert(loaded && "failed to read the graph\n");
+    info = edge_list_build(graph, &edges);
+    assert(info == GrB_SUCCESS && "GraphBlas: failed to build the graph\n");
+    edge_list_free(&edges);
+
+    if (DIRECTED) {
+        run_census(graph);
+        return 0;
+    }
 
-    double timer[2];
+    double timer[3];
 
     uint64_t res = 0;
+    int64_t nwedge = 0;
+
+    for (int i = 1; i <= NMETHODS; ++i) {
+        // the wedges are counted once, alongside the first method
+        mytricount(&res, (i == 1) ? &nwedge : NULL, i % NMETHODS, graph, timer);
 
-    for (int i = 1; i <= 7; ++i) {
-        mytricount(&res, i % 7, graph, timer);
+        if (i == 1) {
+            printf("Number of wedges in graph = %ld\n", nwedge);
+            printf("Global clustering coefficient = %f\n\n",
+                (nwedge > 0) ? (3.0 * res) / nwedge : 0.0);
+        }
 
-        printf("%s number of triangles in graph = %ld\n", METHODS[i % 7], res);
-        printf("%s used time (in seconds): %f\n\n", METHODS[i % 7], timer[0] + timer[1]);
+        printf("%s number of triangles in graph = %ld\n", METHODS[i % NMETHODS], res);
+        printf("%s used time (in seconds): %f\n\n", METHODS[i % NMETHODS], timer[0] + timer[1]);
         fflush(NULL);
     }
 
+    if (CLIQUE_SIZE == 0) {
+        return 0;
+    }
+
+    // Count the k-cliques on the same oriented L as the Sandia methods.  This
+    // grows quickly with k on dense graphs, so it is only done on request.
+    GrB_Matrix L = NULL;
+    info = tri_prep(&L, NULL, graph);
+    assert(info == GrB_SUCCESS && "GraphBlas: failed to construct L\n");
+
+    int nthreads;
+    GxB_get(GxB_NTHREADS, &nthreads);
+
+    int64_t ncliques = 0;
+    double tic[2];
+    simple_tic(tic);
+    info = tri_kclique(&ncliques, CLIQUE_SIZE, L, nthreads);
+    assert(info == GrB_SUCCESS && "failed to count k-cliques\n");
+
+    printf("Number of %d-cliques in graph = %ld\n", CLIQUE_SIZE, ncliques);
+    printf("%d-clique used time (in seconds): %f\n\n", CLIQUE_SIZE, simple_toc(tic));
+    fflush(NULL);
+
+    GrB_free(&L);
+
     return 0;
 }
\ No newline at end of file
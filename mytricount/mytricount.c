@@ -5,14 +5,16 @@
 // Given a symmetric graph A with no-self edges, tricount counts the exact
 // number of triangles in the graph.
 
-// One of 6 methods are used.  Each computes the same result, ntri:
+// One of 8 methods are used.  Each computes the same result, ntri:
 
+//  0:  Naive:      ntri = trace (A^3) / 6
 //  1:  Burkhardt:  ntri = sum (sum ((A^2) .* A)) / 6
 //  2:  Cohen:      ntri = sum (sum ((L * U) .* A)) / 2
 //  3:  Sandia:     ntri = sum (sum ((L * L) .* L))
 //  4:  Sandia2:    ntri = sum (sum ((U * U) .* U))
 //  5:  SandiaDot:  ntri = sum (sum ((L * U') .* L)).  Note that L=U'.
 //  6:  SandiaDot2: ntri = sum (sum ((U * L') .* U))
+//  7:  Forward:    compact-forward on the CSR arrays of L (see tri_forward.c)
 
 // All matrices are assumed to be in CSR format (GxB_BY_ROW).
 
@@ -30,6 +32,10 @@
 // method is equivalent to (L*L).*L in SuiteSparse:GraphBLAS when the matrices
 // in SuiteSparse:GraphBLAS are in their default format (also by row).
 
+// Method 7 does not use a semiring.  It exports a copy of the same L used by
+// the Sandia methods, orients each edge by degree, and counts the triangles
+// with a native OpenMP kernel.
+
 // A is a binary square symmetric matrix.  E is the edge incidence matrix of A.
 // L=tril(A), and U=triu(A).  See GraphBLAS/Demo/tricount.m for a complete
 // definition of each method and the matrices A, E, L, and U, and citations of
@@ -46,13 +52,46 @@
 // C<M>=A'*B uses the dot product method by default, whereas C<M>=A*B' uses the
 // dot product method if the matrices are stored by row.
 
-#define FREE_ALL                \
+// If p_nwedge is not NULL, the number of wedges is also returned, so that the
+// global clustering coefficient 3*ntri/nwedge can be computed.  The wedges are
+// counted by tri_wedges in a separate thread, which overlaps with the multiply
+// phase of the selected method.  The thread is joined after the timers are
+// taken, so t [0] and t [1] never include the wait for the wedge count.  If
+// the hardware counters are open (see perf/perf_counters.h), they would count
+// the wedge thread as part of the multiply phase, so the wedges are counted
+// after the last phase instead, on the calling thread.
+
+#define FREE_WORK               \
     GrB_free (&Two) ;           \
     GrB_free (&d) ;             \
     GrB_free (&S) ;             \
-    GrB_free (&C) ;
+    GrB_free (&C) ;             \
+    GrB_free (&L) ;             \
+    GrB_free (&U) ;
+
+#define WEDGE_JOIN                              \
+    if (wedge_thread_started)                   \
+    {                                           \
+        pthread_join (wedge_thread, NULL) ;     \
+        wedge_thread_started = false ;          \
+    }
 
+#define FREE_ALL                \
+    FREE_WORK ;                 \
+    perf_phase_cancel ( ) ;     \
+    WEDGE_JOIN
+
+// MULTIPLY_DONE ends the multiply phase and starts the reduce phase, for both
+// the timer and the hardware counters (see perf/perf_counters.h)
+#define MULTIPLY_DONE                           \
+    t [0] = simple_toc (tic) ;                  \
+    perf_phase_end (PERF_PHASE_MULTIPLY) ;      \
+    perf_phase_begin ( ) ;                      \
+    simple_tic (tic)
+
+#include <pthread.h>
 #include "mytricount.h"
+#include "../perf/perf_counters.h"
 
 //------------------------------------------------------------------------------
 // two:  unary function for GrB_apply
@@ -63,6 +102,26 @@ void two (uint32_t *z, const uint32_t *x)
     (*z) = (double) (((*x) == 2) ? 1 : 0) ;
 }
 
+//------------------------------------------------------------------------------
+// wedge_worker:  pthread body that counts the wedges via tri_wedges
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    GrB_Matrix A ;          // adjacency matrix
+    int64_t nwedge ;        // # of wedges, computed by the worker
+    GrB_Info info ;         // status of tri_wedges
+}
+wedge_work ;
+
+static void *wedge_worker (void *arg)
+{
+    wedge_work *w = (wedge_work *) arg ;
+    // use a single thread, so the multiply keeps all the others
+    w->info = tri_wedges (&(w->nwedge), w->A, 1) ;
+    return (NULL) ;
+}
+
 //------------------------------------------------------------------------------
 // tricount: count the number of triangles in a graph
 //------------------------------------------------------------------------------
@@ -70,9 +129,11 @@ void two (uint32_t *z, const uint32_t *x)
 GrB_Info mytricount           // count # of triangles
 (
     int64_t *p_ntri,        // # of trianagles
-    const int method,       // 1 to 6, see above
+    int64_t *p_nwedge,      // # of wedges, not computed if NULL
+    const int method,       // 0 to 7, see above
     const GrB_Matrix A,     // adjacency matrix
-    double t [2]            // t [0]: multiply time, t [1]: reduce time
+    double t [3]            // t [0]: multiply time, t [1]: reduce time,
+                            // t [2]: preprocessing time
 )
 {
 
@@ -83,28 +144,33 @@ GrB_Info mytricount           // count # of triangles
     double tic [2] ;
     GrB_Info info ;
     int64_t ntri ;
-    GrB_Index n, ne ;
+    GrB_Index n ;
     GrB_UnaryOp Two = NULL ;
     GrB_Matrix S = NULL, C = NULL, L = NULL, U = NULL ;
-    GxB_Scalar Thunk = NULL ;
     GrB_Descriptor d = NULL ;
+    pthread_t wedge_thread ;
+    bool wedge_thread_started = false ;
+    wedge_work wedge = { .A = A, .nwedge = 0, .info = GrB_SUCCESS } ;
     OK (GrB_Descriptor_new (&d)) ;
+    // the masks A, L, and U hold only ones, so only their pattern is needed
+    OK (GxB_set (d, GrB_MASK, GxB_STRUCTURE)) ;
 
-    OK (GxB_Scalar_new (&Thunk, GrB_INT64)) ;
-
-    OK (GrB_Matrix_nrows (&n, A)) ;
-
-    // U = triu (A,1)
-    OK (GxB_Scalar_setElement (Thunk, (int64_t) 1)) ;
-    OK (GrB_Matrix_new (&U, GrB_UINT32, n, n)) ;
-    OK (GxB_select (U, NULL, NULL, GxB_TRIU, A, Thunk, NULL)) ;
-    OK (GrB_Matrix_nvals (&ne, U)) ;
+    // L = tril (A,-1) and U = triu (A,1)
+    perf_phase_begin ( ) ;
+    simple_tic (tic) ;
+    OK (tri_prep (&L, &U, A)) ;
+    t [2] = simple_toc (tic) ;
+    perf_phase_end (PERF_PHASE_PREP) ;
 
-    // L = tril (A,-1)
-    OK (GrB_Matrix_new (&L, GrB_UINT32, n, n)) ;
-    OK (GxB_Scalar_setElement (Thunk, (int64_t) (-1))) ;
-    OK (GxB_select (L, NULL, NULL, GxB_TRIL, A, Thunk, NULL)) ;
+    // start counting the wedges, concurrently with the multiply below
+    if (p_nwedge != NULL && !perf_counters_are_open ( ))
+    {
+        CHECK (pthread_create (&wedge_thread, NULL, wedge_worker, &wedge) == 0,
+            GrB_PANIC) ;
+        wedge_thread_started = true ;
+    }
 
+    perf_phase_begin ( ) ;
     simple_tic (tic) ;
 
     switch (method)
@@ -120,8 +186,7 @@ GrB_Info mytricount           // count # of triangles
             OK (GxB_set (d, GxB_AxB_METHOD, GxB_AxB_GUSTAVSON)) ;
             OK (GrB_mxm(C, GrB_NULL, GrB_NULL, s, C, A, d)) ;
             OK (GrB_mxm(C, GrB_NULL, GrB_NULL, s, C, A, d)) ;
-            t [0] = simple_toc (tic);
-            simple_tic (tic);
+            MULTIPLY_DONE ;
             GrB_Matrix trace;
             OK (GrB_Matrix_new(&trace, GrB_UINT32, n, n)) ;
             OK (GxB_select(trace, GrB_NULL, GrB_PLUS_UINT64, GxB_DIAG, C, GrB_NULL, d)) ;
@@ -136,8 +201,7 @@ GrB_Info mytricount           // count # of triangles
             // mxm:  outer product method, with mask
             OK (GxB_set (d, GxB_AxB_METHOD, GxB_AxB_GUSTAVSON)) ;
             OK (GrB_mxm (C, A, NULL, GxB_PLUS_TIMES_UINT32, A, A, d)) ;
-            t [0] = simple_toc (tic) ;
-            simple_tic (tic) ;
+            MULTIPLY_DONE ;
             OK (GrB_reduce (&ntri, NULL, GxB_PLUS_INT64_MONOID, C, NULL)) ;
             ntri /= 6 ;
             break ;
@@ -149,8 +213,7 @@ GrB_Info mytricount           // count # of triangles
             // mxm:  outer product method, with mask
             OK (GxB_set (d, GxB_AxB_METHOD, GxB_AxB_GUSTAVSON)) ;
             OK (GrB_mxm (C, A, NULL, GxB_PLUS_TIMES_UINT32, L, U, d)) ;
-            t [0] = simple_toc (tic) ;
-            simple_tic (tic) ;
+            MULTIPLY_DONE ;
             OK (GrB_reduce (&ntri, NULL, GxB_PLUS_INT64_MONOID, C, NULL)) ;
             ntri /= 2 ;
             break ;
@@ -161,8 +224,7 @@ GrB_Info mytricount           // count # of triangles
             OK (GrB_Matrix_new (&C, GrB_UINT32, n, n)) ;
             OK (GxB_set (d, GxB_AxB_METHOD, GxB_AxB_GUSTAVSON)) ;
             OK (GrB_mxm (C, L, NULL, GxB_PLUS_TIMES_UINT32, L, L, d)) ;
-            t [0] = simple_toc (tic) ;
-            simple_tic (tic) ;
+            MULTIPLY_DONE ;
             OK (GrB_reduce (&ntri, NULL, GxB_PLUS_INT64_MONOID, C, NULL)) ;
             break ;
 
@@ -173,8 +235,7 @@ GrB_Info mytricount           // count # of triangles
             // mxm:  outer product method, with mask
             OK (GxB_set (d, GxB_AxB_METHOD, GxB_AxB_GUSTAVSON)) ;
             OK (GrB_mxm (C, U, NULL, GxB_PLUS_TIMES_UINT32, U, U, d)) ;
-            t [0] = simple_toc (tic) ;
-            simple_tic (tic) ;
+            MULTIPLY_DONE ;
             OK (GrB_reduce (&ntri, NULL, GxB_PLUS_INT64_MONOID, C, NULL)) ;
             break ;
 
@@ -183,12 +244,12 @@ GrB_Info mytricount           // count # of triangles
             OK (GrB_Matrix_nrows (&n, U)) ;
             OK (GrB_Matrix_new (&C, GrB_UINT32, n, n)) ;
             OK (GrB_Descriptor_new (&d)) ;
+            OK (GxB_set (d, GrB_MASK, GxB_STRUCTURE)) ;
             OK (GxB_set (d, GrB_INP1, GrB_TRAN)) ;
             // mxm:  dot product method, with mask
             OK (GxB_set (d, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
             OK (GrB_mxm (C, L, NULL, GxB_PLUS_TIMES_UINT32, L, U, d)) ;
-            t [0] = simple_toc (tic) ;
-            simple_tic (tic) ;
+            MULTIPLY_DONE ;
             OK (GrB_reduce (&ntri, NULL, GxB_PLUS_INT64_MONOID, C, NULL)) ;
             break ;
 
@@ -197,23 +258,48 @@ GrB_Info mytricount           // count # of triangles
             OK (GrB_Matrix_nrows (&n, U)) ;
             OK (GrB_Matrix_new (&C, GrB_UINT32, n, n)) ;
             OK (GrB_Descriptor_new (&d)) ;
+            OK (GxB_set (d, GrB_MASK, GxB_STRUCTURE)) ;
             OK (GxB_set (d, GrB_INP1, GrB_TRAN)) ;
             // mxm:  dot product method, with mask
             OK (GxB_set (d, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
             OK (GrB_mxm (C, U, NULL, GxB_PLUS_TIMES_UINT32, U, L, d)) ;
-            t [0] = simple_toc (tic) ;
-            simple_tic (tic) ;
+            MULTIPLY_DONE ;
             OK (GrB_reduce (&ntri, NULL, GxB_PLUS_INT64_MONOID, C, NULL)) ;
             break ;
 
+        case 7:  // Forward:    compact-forward on the CSR arrays of L
+
+            {
+                int nthreads ;
+                OK (GxB_get (GxB_NTHREADS, &nthreads)) ;
+                OK (tri_forward (&ntri, L, nthreads)) ;
+            }
+            MULTIPLY_DONE ;
+            break ;
+
         default:    // invalid method
 
+            FREE_ALL ;
             return (GrB_INVALID_VALUE) ;
             break ;
     }
 
-    FREE_ALL ;
+    FREE_WORK ;
     t [1] = simple_toc (tic) ;
+    perf_phase_end (PERF_PHASE_REDUCE) ;
+    WEDGE_JOIN ;
+    if (p_nwedge != NULL && perf_counters_are_open ( ))
+    { 
+        // count the wedges now that no phase is being counted
+        int nthreads ;
+        OK (GxB_get (GxB_NTHREADS, &nthreads)) ;
+        wedge.info = tri_wedges (&(wedge.nwedge), A, nthreads) ;
+    }
+    if (p_nwedge != NULL)
+    {
+        if (wedge.info != GrB_SUCCESS) return (wedge.info) ;
+        (*p_nwedge) = wedge.nwedge ;
+    }
     (*p_ntri) = ntri ;
     return (GrB_SUCCESS) ;
 }
@@ -5,7 +5,61 @@
 GrB_Info mytricount           // count # of triangles
 (
     int64_t *p_ntri,        // # of trianagles
-    const int method,       // 1 to 6, see above
+    int64_t *p_nwedge,      // # of wedges, not computed if NULL
+    const int method,       // 0 to 7, see mytricount.c
     const GrB_Matrix A,     // adjacency matrix
-    double t [2]            // t [0]: multiply time, t [1]: reduce time
+    double t [3]            // t [0]: multiply time, t [1]: reduce time,
+                            // t [2]: preprocessing time
 );
+
+GrB_Info tri_forward        // count # of triangles with compact-forward
+(
+    int64_t *p_ntri,        // # of triangles
+    const GrB_Matrix L,     // L = tril (A,-1), held by row
+    int nthreads            // # of threads to use
+) ;
+
+GrB_Info tri_wedges         // count # of wedges
+(
+    int64_t *p_nwedge,      // # of wedges
+    const GrB_Matrix A,     // adjacency matrix
+    int nthreads            // # of threads to use
+) ;
+
+// L and U are GrB_UINT32.  If A is GrB_UINT32 they are views of A, and A
+// must not be modified or freed until they are freed (see tri_prep.c).
+GrB_Info tri_prep           // construct L = tril (A,-1) and U = triu (A,1)
+(
+    GrB_Matrix *L_handle,   // L = tril (A,-1), not computed if NULL
+    GrB_Matrix *U_handle,   // U = triu (A,1), not computed if NULL
+    const GrB_Matrix A      // adjacency matrix
+) ;
+
+GrB_Info tri_kclique        // count # of k-cliques
+(
+    int64_t *p_ncliques,    // # of k-cliques
+    const int k,            // size of each clique, k >= 2
+    const GrB_Matrix L,     // L = tril (A,-1), held by row
+    int nthreads            // # of threads to use
+) ;
+
+// directed triangle types counted by tri_census
+enum
+{
+    TRI_CENSUS_030T,        // a->b, b->c, a->c     (transitive)
+    TRI_CENSUS_030C,        // a->b, b->c, c->a     (cyclic)
+    TRI_CENSUS_120D,        // a<->b, c->a, c->b
+    TRI_CENSUS_120U,        // a<->b, a->c, b->c
+    TRI_CENSUS_120C,        // a<->b, a->c, c->b
+    TRI_CENSUS_210,         // a<->b, b<->c, a->c
+    TRI_CENSUS_300,         // a<->b, b<->c, a<->c
+    TRI_CENSUS_NTYPES
+} ;
+
+extern const char *tri_census_names [TRI_CENSUS_NTYPES] ;
+
+GrB_Info tri_census         // count # of triangles of each directed type
+(
+    int64_t census [TRI_CENSUS_NTYPES], // census [t]: # of triangles of type t
+    const GrB_Matrix A      // directed adjacency matrix
+) ;
@@ -0,0 +1,157 @@
+//------------------------------------------------------------------------------
+// tri_census.c: directed triangle census of a graph
+//------------------------------------------------------------------------------
+
+// Given a directed graph A with no self-edges, tri_census counts the triangles
+// of each directed type.  A triangle is a set of three nodes where each pair
+// is joined by at least one edge.  In the MAN notation of Holland and
+// Leinhardt, the seven directed types are:
+
+//  030T:   a->b, b->c, a->c            (transitive)
+//  030C:   a->b, b->c, c->a            (cyclic)
+//  120D:   a<->b, c->a, c->b
+//  120U:   a<->b, a->c, b->c
+//  120C:   a<->b, a->c, c->b
+//  210:    a<->b, b<->c, a->c
+//  300:    a<->b, b<->c, a<->c
+
+// A is split into its mutual part M = A .* A' and its asymmetric part N, the
+// entries of A not in M, so that A = M + N, A' = M + N', and the undirected
+// graph is S = M + N + N'.  Each count is then the sum of a masked product:
+
+//  030T = sum (sum ((N*N) .* N))
+//  030C = sum (sum ((N*N) .* N')) / 3
+//  120C = sum (sum ((N*N) .* M))
+//  210  = sum (sum ((M*M) .* N))
+//  300  = sum (sum ((M*M) .* M)) / 6
+//  120U = sum (sum ((M*N) .* N)) / 2
+//  120D = sum (sum ((N*M) .* N)) / 2
+
+// N*N and M*M are each computed once, with S as the mask, and then reused
+// for all the types that need them, so the census takes four masked
+// multiplies.  The sum of all seven counts is the number of triangles in S.
+
+#define FREE_ALL                \
+    GrB_free (&At) ;            \
+    GrB_free (&S) ;             \
+    GrB_free (&M) ;             \
+    GrB_free (&N) ;             \
+    GrB_free (&Nt) ;            \
+    GrB_free (&P) ;             \
+    GrB_free (&T) ;             \
+    GrB_free (&desc) ;
+
+#include "mytricount.h"
+
+const char *tri_census_names [TRI_CENSUS_NTYPES] =
+{
+    "030T", "030C", "120D", "120U", "120C", "210", "300"
+} ;
+
+//------------------------------------------------------------------------------
+// census_sum: sum (sum (P .* Mask)), using T as workspace
+//------------------------------------------------------------------------------
+
+static GrB_Info census_sum
+(
+    int64_t *result,
+    GrB_Matrix T,
+    const GrB_Matrix P,
+    const GrB_Matrix Mask
+)
+{
+    GrB_Info info = GrB_eWiseMult (T, NULL, NULL, GrB_TIMES_UINT32, P, Mask,
+        NULL) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    return (GrB_reduce (result, NULL, GxB_PLUS_INT64_MONOID, T, NULL)) ;
+}
+
+//------------------------------------------------------------------------------
+// tri_census: directed triangle census of a graph
+//------------------------------------------------------------------------------
+
+GrB_Info tri_census         // count # of triangles of each directed type
+(
+    int64_t census [TRI_CENSUS_NTYPES], // census [t]: # of triangles of type t
+    const GrB_Matrix A      // directed adjacency matrix
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Index n ;
+    int64_t s ;
+    GrB_Matrix At = NULL, S = NULL, M = NULL, N = NULL, Nt = NULL, P = NULL,
+        T = NULL ;
+    GrB_Descriptor desc = NULL ;
+
+    OK (GrB_Matrix_nrows (&n, A)) ;
+
+    //--------------------------------------------------------------------------
+    // split A into its mutual and asymmetric parts
+    //--------------------------------------------------------------------------
+
+    // At = A'
+    OK (GrB_Matrix_new (&At, GrB_UINT32, n, n)) ;
+    OK (GrB_transpose (At, NULL, NULL, A, NULL)) ;
+
+    // S = A + A', the undirected graph
+    OK (GrB_Matrix_new (&S, GrB_UINT32, n, n)) ;
+    OK (GrB_eWiseAdd (S, NULL, NULL, GrB_FIRST_UINT32, A, At, NULL)) ;
+
+    // M = A .* A', the mutual edges
+    OK (GrB_Matrix_new (&M, GrB_UINT32, n, n)) ;
+    OK (GrB_eWiseMult (M, NULL, NULL, GrB_FIRST_UINT32, A, At, NULL)) ;
+    GrB_free (&At) ;
+
+    // N<!M> = A, the asymmetric edges
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GxB_set (desc, GrB_MASK, GrB_SCMP)) ;
+    OK (GrB_Matrix_new (&N, GrB_UINT32, n, n)) ;
+    OK (GrB_apply (N, M, NULL, GrB_IDENTITY_UINT32, A, desc)) ;
+
+    // Nt = N'
+    OK (GrB_Matrix_new (&Nt, GrB_UINT32, n, n)) ;
+    OK (GrB_transpose (Nt, NULL, NULL, N, NULL)) ;
+
+    OK (GrB_Matrix_new (&P, GrB_UINT32, n, n)) ;
+    OK (GrB_Matrix_new (&T, GrB_UINT32, n, n)) ;
+
+    //--------------------------------------------------------------------------
+    // types with two asymmetric edges on a path: P<S> = N*N
+    //--------------------------------------------------------------------------
+
+    OK (GrB_mxm (P, S, NULL, GxB_PLUS_TIMES_UINT32, N, N, NULL)) ;
+    OK (census_sum (&s, T, P, N )) ; census [TRI_CENSUS_030T] = s ;
+    OK (census_sum (&s, T, P, Nt)) ; census [TRI_CENSUS_030C] = s / 3 ;
+    OK (census_sum (&s, T, P, M )) ; census [TRI_CENSUS_120C] = s ;
+
+    //--------------------------------------------------------------------------
+    // types with two mutual edges on a path: P<S> = M*M
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_clear (P)) ;
+    OK (GrB_mxm (P, S, NULL, GxB_PLUS_TIMES_UINT32, M, M, NULL)) ;
+    OK (census_sum (&s, T, P, N )) ; census [TRI_CENSUS_210 ] = s ;
+    OK (census_sum (&s, T, P, M )) ; census [TRI_CENSUS_300 ] = s / 6 ;
+
+    //--------------------------------------------------------------------------
+    // types with one mutual edge: P<N> = M*N and P<N> = N*M
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_clear (P)) ;
+    OK (GrB_mxm (P, N, NULL, GxB_PLUS_TIMES_UINT32, M, N, NULL)) ;
+    OK (GrB_reduce (&s, NULL, GxB_PLUS_INT64_MONOID, P, NULL)) ;
+    census [TRI_CENSUS_120U] = s / 2 ;
+
+    OK (GrB_Matrix_clear (P)) ;
+    OK (GrB_mxm (P, N, NULL, GxB_PLUS_TIMES_UINT32, N, M, NULL)) ;
+    OK (GrB_reduce (&s, NULL, GxB_PLUS_INT64_MONOID, P, NULL)) ;
+    census [TRI_CENSUS_120D] = s / 2 ;
+
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,207 @@
+//------------------------------------------------------------------------------
+// tri_forward.c: count triangles with the compact-forward method
+//------------------------------------------------------------------------------
+
+// Given L = tril (A,-1) for a symmetric graph A with no self-edges, the
+// compact-forward method counts the triangles directly on the CSR arrays of L,
+// without using the GraphBLAS semiring kernels.  It is the native counterpart
+// of the outer-product kernels in GraphBLAS/Extras/tri/tri_template.c.
+
+// Each edge is first oriented from the endpoint of lower degree to the
+// endpoint of higher degree (ties broken by vertex index), which bounds the
+// out-degree of every vertex by O(sqrt(nnz(L))).  Then for each vertex u, the
+// out-neighbors of u are scattered into a Mark array, and for each out-neighbor
+// v of u, every out-neighbor w of v that is marked closes the triangle (u,v,w).
+// Each triangle is found exactly once.
+
+// The counting loop is parallel over the vertices u, with dynamic scheduling
+// since the work per vertex is highly irregular.  Each thread has its own
+// Mark array of size n.
+
+#define FREE_ALL                \
+    GrB_free (&T) ;             \
+    free (Lp) ;                 \
+    free (Lj) ;                 \
+    free (Lx) ;                 \
+    free (Deg) ;                \
+    free (Fp) ;                 \
+    free (Fj) ;                 \
+    free (Fnext) ;
+
+#include "mytricount.h"
+
+// scheduler chunk size for the counting loop
+#define FORWARD_CHUNK 256
+
+// true if the edge (u,v) is oriented from u to v
+#define FORWARD(u,v) \
+    (Deg [u] < Deg [v] || (Deg [u] == Deg [v] && (u) < (v)))
+
+GrB_Info tri_forward        // count # of triangles with compact-forward
+(
+    int64_t *p_ntri,        // # of triangles
+    const GrB_Matrix L,     // L = tril (A,-1), held by row
+    int nthreads            // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // export a copy of L in CSR form
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix T = NULL ;
+    GrB_Type type ;
+    GrB_Index n, ncols, nvals ;
+    int64_t nonempty ;
+    GrB_Index *Lp = NULL, *Lj = NULL ;
+    void *Lx = NULL ;
+    int64_t *Deg = NULL, *Fp = NULL, *Fnext = NULL ;
+    GrB_Index *Fj = NULL ;
+    int64_t ntri = 0 ;
+    bool ok = true ;
+
+    nthreads = MAX (nthreads, 1) ;
+
+    OK (GrB_Matrix_dup (&T, L)) ;
+    OK (GxB_Matrix_export_CSR (&T, &type, &n, &ncols, &nvals, &nonempty,
+        &Lp, &Lj, &Lx, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    Deg   = (int64_t *) calloc (n + 1, sizeof (int64_t)) ;
+    Fp    = (int64_t *) calloc (n + 1, sizeof (int64_t)) ;
+    Fnext = (int64_t *) malloc ((n + 1) * sizeof (int64_t)) ;
+    Fj    = (GrB_Index *) malloc ((nvals + 1) * sizeof (GrB_Index)) ;
+    CHECK (Deg != NULL && Fp != NULL && Fnext != NULL && Fj != NULL,
+        GrB_OUT_OF_MEMORY) ;
+
+    //--------------------------------------------------------------------------
+    // compute the degree of each vertex
+    //--------------------------------------------------------------------------
+
+    // deg (i) is the # of entries in L(i,:) plus the # of entries in L(:,i)
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int64_t i = 0 ; i < (int64_t) n ; i++)
+    {
+        int64_t d = Lp [i+1] - Lp [i] ;
+        #pragma omp atomic
+        Deg [i] += d ;
+        for (int64_t p = Lp [i] ; p < (int64_t) Lp [i+1] ; p++)
+        {
+            #pragma omp atomic
+            Deg [Lj [p]]++ ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // orient each edge by degree
+    //--------------------------------------------------------------------------
+
+    // count the out-degree of each vertex
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int64_t i = 0 ; i < (int64_t) n ; i++)
+    {
+        for (int64_t p = Lp [i] ; p < (int64_t) Lp [i+1] ; p++)
+        {
+            int64_t j = Lj [p] ;
+            int64_t u = FORWARD (i,j) ? i : j ;
+            #pragma omp atomic
+            Fp [u]++ ;
+        }
+    }
+
+    // cumulative sum: Fp [u] becomes the start of the out-list of u
+    int64_t s = 0 ;
+    for (int64_t u = 0 ; u <= (int64_t) n ; u++)
+    {
+        int64_t c = Fp [u] ;
+        Fp [u] = s ;
+        Fnext [u] = s ;
+        s += c ;
+    }
+
+    // scatter each edge into the out-list of its source vertex
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int64_t i = 0 ; i < (int64_t) n ; i++)
+    {
+        for (int64_t p = Lp [i] ; p < (int64_t) Lp [i+1] ; p++)
+        {
+            int64_t j = Lj [p] ;
+            int64_t u, v ;
+            if (FORWARD (i,j)) { u = i ; v = j ; } else { u = j ; v = i ; }
+            int64_t pf ;
+            #pragma omp atomic capture
+            pf = Fnext [u]++ ;
+            Fj [pf] = v ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // count the triangles
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel num_threads(nthreads) reduction(+:ntri)
+    {
+        // each thread needs its own private workspace, Mark [0..n-1] = 0
+        bool *Mark = (bool *) calloc (n + 1, sizeof (bool)) ;
+        if (Mark == NULL)
+        {
+            #pragma omp atomic write
+            ok = false ;
+        }
+
+        // all threads see every allocation before they decide, so either all
+        // of them or none reach the work-sharing loop and its barrier
+        #pragma omp barrier
+        bool all_ok ;
+        #pragma omp atomic read
+        all_ok = ok ;
+
+        if (all_ok)
+        {
+            #pragma omp for schedule(dynamic,FORWARD_CHUNK)
+            for (int64_t u = 0 ; u < (int64_t) n ; u++)
+            {
+                int64_t pstart = Fp [u] ;
+                int64_t pend   = Fp [u+1] ;
+                if (pend - pstart < 2) continue ;
+
+                // scatter the out-neighbors of u into Mark
+                for (int64_t p = pstart ; p < pend ; p++)
+                {
+                    Mark [Fj [p]] = 1 ;
+                }
+
+                // each marked out-neighbor w of v closes a triangle (u,v,w)
+                for (int64_t p = pstart ; p < pend ; p++)
+                {
+                    const int64_t v = Fj [p] ;
+                    for (int64_t pv = Fp [v] ; pv < Fp [v+1] ; pv++)
+                    {
+                        ntri += Mark [Fj [pv]] ;
+                    }
+                }
+
+                // clear the Mark array
+                for (int64_t p = pstart ; p < pend ; p++)
+                {
+                    Mark [Fj [p]] = 0 ;
+                }
+            }
+        }
+        free (Mark) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    T = NULL ;      // T was freed by the export
+    FREE_ALL ;
+    if (!ok) return (GrB_OUT_OF_MEMORY) ;
+    (*p_ntri) = ntri ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,303 @@
+//------------------------------------------------------------------------------
+// tri_kclique.c: count the number of k-cliques in a graph
+//------------------------------------------------------------------------------
+
+// Given L = tril (A,-1) for a symmetric graph A with no self-edges, tri_kclique
+// counts the number of k-cliques in the graph.  It generalizes the Sandia
+// method:  for k = 3, the result is sum (sum ((L * L) .* L)), the number of
+// triangles.
+
+// L orients each edge from the larger vertex to the smaller one, so each
+// k-clique is found exactly once, from its largest vertex v.  The candidate
+// set for the clique is initially L(v,:).  Each vertex u taken from the
+// candidate set C restricts it to C .* L(u,:), the masked intersection of the
+// two sorted lists, and the recursion continues until k vertices are chosen.
+// At the last level only the size of the intersection is needed, so it is
+// counted but not stored.
+
+// The intersections use the same strategy as the dot product kernel of
+// GraphBLAS (Template/GB_AxB_dot_cij.c):  nothing is done if the two lists do
+// not overlap, a binary search is used if one list is much sparser than the
+// other, and a linear-time merge is used otherwise.
+
+// The outer loop over the vertices v is parallel, with dynamic scheduling
+// since the work per vertex is highly irregular.  Each thread allocates one
+// scratch buffer per recursion level, of size max (degree (L)), before the
+// loop starts, so no memory is allocated while the cliques are counted.
+
+#define FREE_ALL                \
+    GrB_free (&T) ;             \
+    free (Lp) ;                 \
+    free (Lj) ;                 \
+    free (Lx) ;
+
+#include "mytricount.h"
+
+// scheduler chunk size for the loop over the vertices
+#define KCLIQUE_CHUNK 64
+
+// use binary search if one list is this many times larger than the other
+#define KCLIQUE_LOGSEARCH 32
+
+//------------------------------------------------------------------------------
+// kclique_intersect: C2 = C .* L(u,:), or its size
+//------------------------------------------------------------------------------
+
+// Both lists are sorted.  If C2 is NULL, only the size of the intersection is
+// returned.
+
+static inline int64_t kclique_intersect
+(
+    GrB_Index *restrict C2,         // output list, or NULL to just count
+    const GrB_Index *restrict C,    // candidate set, size cnz
+    const int64_t cnz,
+    const GrB_Index *restrict Li,   // L(u,:), size lnz
+    const int64_t lnz
+)
+{
+    int64_t c2nz = 0 ;
+
+    if (cnz == 0 || lnz == 0 || C [cnz-1] < Li [0] || Li [lnz-1] < C [0])
+    {
+
+        //----------------------------------------------------------------------
+        // the patterns of the two lists do not overlap
+        //----------------------------------------------------------------------
+
+        ;
+
+    }
+    else if (lnz > KCLIQUE_LOGSEARCH * cnz)
+    {
+
+        //----------------------------------------------------------------------
+        // C is very sparse compared with L(u,:): binary search in L(u,:)
+        //----------------------------------------------------------------------
+
+        int64_t pleft = 0 ;
+        for (int64_t p = 0 ; p < cnz ; p++)
+        {
+            GrB_Index i = C [p] ;
+            int64_t pright = lnz - 1 ;
+            while (pleft < pright)
+            {
+                int64_t pmiddle = (pleft + pright) / 2 ;
+                if (Li [pmiddle] < i) pleft = pmiddle + 1 ; else pright = pmiddle ;
+            }
+            if (pleft == pright && Li [pleft] == i)
+            {
+                if (C2 != NULL) C2 [c2nz] = i ;
+                c2nz++ ;
+            }
+        }
+
+    }
+    else if (cnz > KCLIQUE_LOGSEARCH * lnz)
+    {
+
+        //----------------------------------------------------------------------
+        // L(u,:) is very sparse compared with C: binary search in C
+        //----------------------------------------------------------------------
+
+        int64_t pleft = 0 ;
+        for (int64_t p = 0 ; p < lnz ; p++)
+        {
+            GrB_Index i = Li [p] ;
+            int64_t pright = cnz - 1 ;
+            while (pleft < pright)
+            {
+                int64_t pmiddle = (pleft + pright) / 2 ;
+                if (C [pmiddle] < i) pleft = pmiddle + 1 ; else pright = pmiddle ;
+            }
+            if (pleft == pright && C [pleft] == i)
+            {
+                if (C2 != NULL) C2 [c2nz] = i ;
+                c2nz++ ;
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // linear-time merge of the two lists
+        //----------------------------------------------------------------------
+
+        int64_t p = 0, pl = 0 ;
+        while (p < cnz && pl < lnz)
+        {
+            if (C [p] < Li [pl])
+            {
+                p++ ;
+            }
+            else if (Li [pl] < C [p])
+            {
+                pl++ ;
+            }
+            else
+            {
+                if (C2 != NULL) C2 [c2nz] = C [p] ;
+                c2nz++ ;
+                p++ ;
+                pl++ ;
+            }
+        }
+    }
+
+    return (c2nz) ;
+}
+
+//------------------------------------------------------------------------------
+// kclique_count: count the cliques that extend a clique by depth vertices
+//------------------------------------------------------------------------------
+
+// Each vertex in the candidate set C is adjacent to every vertex of the clique
+// found so far.  Work [depth] is the scratch buffer for the candidate sets
+// created at this level of the recursion.
+
+static int64_t kclique_count
+(
+    const GrB_Index *restrict C,    // candidate set, size cnz
+    const int64_t cnz,
+    const int depth,                // # of vertices still to add to the clique
+    const GrB_Index *restrict Lp,   // L in CSR form
+    const GrB_Index *restrict Lj,
+    GrB_Index **Work                // scratch buffers, one per level
+)
+{
+    if (depth == 1) return (cnz) ;
+
+    int64_t count = 0 ;
+    GrB_Index *restrict C2 = (depth == 2) ? NULL : Work [depth] ;
+
+    // C is sorted, and all of L(u,:) is less than u, so only C [0..p-1] can
+    // appear in L(u,:).  At least depth-1 of them are needed.
+    for (int64_t p = depth - 1 ; p < cnz ; p++)
+    {
+        const GrB_Index u = C [p] ;
+        const int64_t pstart = Lp [u] ;
+        const int64_t lnz = Lp [u+1] - pstart ;
+        int64_t c2nz = kclique_intersect (C2, C, p, Lj + pstart, lnz) ;
+        if (depth == 2)
+        {
+            count += c2nz ;
+        }
+        else if (c2nz >= depth - 1)
+        {
+            count += kclique_count (C2, c2nz, depth - 1, Lp, Lj, Work) ;
+        }
+    }
+
+    return (count) ;
+}
+
+//------------------------------------------------------------------------------
+// tri_kclique: count the number of k-cliques in a graph
+//------------------------------------------------------------------------------
+
+GrB_Info tri_kclique        // count # of k-cliques
+(
+    int64_t *p_ncliques,    // # of k-cliques
+    const int k,            // size of each clique, k >= 2
+    const GrB_Matrix L,     // L = tril (A,-1), held by row
+    int nthreads            // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and export a copy of L in CSR form
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix T = NULL ;
+    GrB_Type type ;
+    GrB_Index n, ncols, nvals ;
+    int64_t nonempty ;
+    GrB_Index *Lp = NULL, *Lj = NULL ;
+    void *Lx = NULL ;
+    int64_t ncliques = 0 ;
+    bool ok = true ;
+
+    if (k < 2) return (GrB_INVALID_VALUE) ;
+    nthreads = MAX (nthreads, 1) ;
+
+    OK (GrB_Matrix_dup (&T, L)) ;
+    OK (GxB_Matrix_export_CSR (&T, &type, &n, &ncols, &nvals, &nonempty,
+        &Lp, &Lj, &Lx, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // find the max degree of L, the size of each scratch buffer
+    //--------------------------------------------------------------------------
+
+    int64_t maxdeg = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(max:maxdeg)
+    for (int64_t v = 0 ; v < (int64_t) n ; v++)
+    {
+        maxdeg = MAX (maxdeg, (int64_t) (Lp [v+1] - Lp [v])) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the k-cliques that have v as their largest vertex
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel num_threads(nthreads) reduction(+:ncliques)
+    {
+
+        // each thread needs one scratch buffer for each level 3..k-1 of the
+        // recursion
+        GrB_Index *Work [k] ;
+        bool thread_ok = true ;
+        for (int level = 0 ; level < k ; level++)
+        {
+            Work [level] = NULL ;
+            if (level >= 3)
+            {
+                Work [level] = (GrB_Index *)
+                    malloc ((maxdeg + 1) * sizeof (GrB_Index)) ;
+                thread_ok = thread_ok && (Work [level] != NULL) ;
+            }
+        }
+
+        if (!thread_ok)
+        {
+            #pragma omp atomic write
+            ok = false ;
+        }
+
+        // all threads see every allocation before they decide, so either all
+        // of them or none reach the work-sharing loop and its barrier
+        #pragma omp barrier
+        bool all_ok ;
+        #pragma omp atomic read
+        all_ok = ok ;
+
+        if (all_ok)
+        {
+            #pragma omp for schedule(dynamic,KCLIQUE_CHUNK)
+            for (int64_t v = 0 ; v < (int64_t) n ; v++)
+            {
+                const int64_t pstart = Lp [v] ;
+                const int64_t cnz = Lp [v+1] - pstart ;
+                if (cnz < k - 1) continue ;
+                ncliques += kclique_count (Lj + pstart, cnz, k - 1, Lp, Lj,
+                    Work) ;
+            }
+        }
+
+        for (int level = 0 ; level < k ; level++)
+        {
+            free (Work [level]) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    if (!ok) return (GrB_OUT_OF_MEMORY) ;
+    (*p_ncliques) = ncliques ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+// tri_prep.c: construct the triangular parts of an adjacency matrix
+//------------------------------------------------------------------------------
+
+// Given a symmetric graph A with no self-edges, tri_prep constructs the
+// strictly lower triangular part L = tril (A,-1) and the strictly upper
+// triangular part U = triu (A,1).  L is the oriented graph used by the Sandia
+// methods of mytricount, by tri_forward, and by tri_kclique.  Either output
+// can be skipped by passing NULL.  L and U are always of type GrB_UINT32, the
+// type of the semirings of mytricount.
+
+// If A is GrB_UINT32 (as built by main.c), L and U are views of A, from
+// GxB_Matrix_tri_view: they share the entries of A, and take only O(n) memory
+// of their own.  The dot product methods of mytricount use them with no copy.
+// Any other use of a view (the saxpy methods, or the export in tri_forward)
+// copies it first, once.  A must then outlive L and U: it must not be
+// modified or freed until L and U are freed.  For any other type of A, L and
+// U are typecast copies, computed by a single call to GxB_Matrix_split_tri.
+
+#define FREE_ALL                \
+    if (L_handle != NULL) GrB_free (L_handle) ; \
+    if (U_handle != NULL) GrB_free (U_handle) ;
+
+#include "mytricount.h"
+
+GrB_Info tri_prep           // construct L = tril (A,-1) and U = triu (A,1)
+(
+    GrB_Matrix *L_handle,   // L = tril (A,-1), not computed if NULL
+    GrB_Matrix *U_handle,   // U = triu (A,1), not computed if NULL
+    const GrB_Matrix A      // adjacency matrix
+)
+{
+
+    GrB_Info info ;
+    GrB_Type type ;
+    GrB_Index n ;
+
+    if (L_handle != NULL) (*L_handle) = NULL ;
+    if (U_handle != NULL) (*U_handle) = NULL ;
+    OK (GxB_Matrix_type (&type, A)) ;
+
+    if (type == GrB_UINT32)
+    { 
+        // L = tril (A,-1) and U = triu (A,1), as views of A
+        return (GxB_Matrix_tri_view (L_handle, U_handle, A)) ;
+    }
+
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    if (L_handle != NULL)
+    { 
+        OK (GrB_Matrix_new (L_handle, GrB_UINT32, n, n)) ;
+    }
+    if (U_handle != NULL)
+    { 
+        OK (GrB_Matrix_new (U_handle, GrB_UINT32, n, n)) ;
+    }
+
+    // L = tril (A,-1) and U = triu (A,1), in one pass over A
+    OK (GxB_Matrix_split_tri ((L_handle == NULL) ? NULL : *L_handle, NULL,
+        (U_handle == NULL) ? NULL : *U_handle, A, NULL)) ;
+
+    return (GrB_SUCCESS) ;
+}
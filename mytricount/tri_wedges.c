@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// tri_wedges.c: count the number of wedges in a graph
+//------------------------------------------------------------------------------
+
+// Given a symmetric graph A with no self-edges, tri_wedges counts the number
+// of wedges (paths of length two), nwedge = sum (d .* (d-1) / 2), where
+// d = sum (A,2) is the degree of each vertex.  The global clustering
+// coefficient (transitivity) of the graph is then 3 * ntri / nwedge.
+
+// The degrees are found with a single row reduction of A, so the edges of A
+// are read just once.  mytricount runs this function in its own thread,
+// concurrently with the multiply phase of the triangle count.
+
+#define FREE_ALL                \
+    GrB_free (&W) ;             \
+    GrB_free (&d) ;             \
+    GrB_free (&desc) ;
+
+#include "mytricount.h"
+
+//------------------------------------------------------------------------------
+// wedges: unary function for GrB_apply
+//------------------------------------------------------------------------------
+
+void wedges (int64_t *z, const int64_t *x)
+{
+    (*z) = ((*x) * ((*x) - 1)) / 2 ;
+}
+
+//------------------------------------------------------------------------------
+// tri_wedges: count the number of wedges in a graph
+//------------------------------------------------------------------------------
+
+GrB_Info tri_wedges         // count # of wedges
+(
+    int64_t *p_nwedge,      // # of wedges
+    const GrB_Matrix A,     // adjacency matrix
+    int nthreads            // # of threads to use
+)
+{
+
+    GrB_Info info ;
+    GrB_Index n ;
+    int64_t nwedge = 0 ;
+    GrB_UnaryOp W = NULL ;
+    GrB_Vector d = NULL ;
+    GrB_Descriptor desc = NULL ;
+
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GxB_set (desc, GxB_NTHREADS, nthreads)) ;
+
+    // d = sum (A,2), the degree of each vertex
+    OK (GrB_Vector_new (&d, GrB_INT64, n)) ;
+    OK (GrB_reduce (d, NULL, NULL, GxB_PLUS_INT64_MONOID, A, desc)) ;
+
+    // d = d .* (d-1) / 2, the # of wedges centered at each vertex
+    OK (GrB_UnaryOp_new (&W, wedges, GrB_INT64, GrB_INT64)) ;
+    OK (GrB_apply (d, NULL, NULL, W, d, desc)) ;
+
+    // nwedge = sum (d)
+    OK (GrB_reduce (&nwedge, NULL, GxB_PLUS_INT64_MONOID, d, desc)) ;
+
+    FREE_ALL ;
+    (*p_nwedge) = nwedge ;
+    return (GrB_SUCCESS) ;
+}
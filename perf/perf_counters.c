@@ -0,0 +1,168 @@
+// Hardware performance counters with perf_event_open (Linux only).
+//
+// Every counter is opened on its own, not as a group, so that a counter the
+// machine lacks does not take the others down with it.  The counters are
+// inherited by the threads created after they are opened; reading a counter
+// sums the counts of all of those threads.
+
+#include <string.h>
+
+#include "perf_counters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+const char* PERF_COUNTER_NAMES[PERF_NCOUNTERS] = {
+    "cycles",
+    "instructions",
+    "llc_misses",
+    "dtlb_misses",
+    "branch_misses"
+};
+
+static int fds[PERF_NCOUNTERS] = {-1, -1, -1, -1, -1};
+static bool opened = false;
+static perf_sample phases[PERF_NPHASES];
+
+#if defined(__linux__)
+
+#define CACHE_MISS_CONFIG(cache) \
+    ((cache) | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+static int open_counter(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+int perf_counters_open(void) {
+    fds[PERF_CYCLES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    fds[PERF_INSTRUCTIONS] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    fds[PERF_LLC_MISSES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    fds[PERF_DTLB_MISSES] = open_counter(PERF_TYPE_HW_CACHE,
+        CACHE_MISS_CONFIG(PERF_COUNT_HW_CACHE_DTLB));
+    fds[PERF_BRANCH_MISSES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+
+    int navailable = 0;
+    for (int c = 0; c < PERF_NCOUNTERS; ++c) {
+        if (fds[c] >= 0) navailable++;
+        for (int p = 0; p < PERF_NPHASES; ++p) {
+            phases[p].count[c] = -1;
+        }
+    }
+    opened = navailable > 0;
+    return navailable;
+}
+
+void perf_counters_close(void) {
+    for (int c = 0; c < PERF_NCOUNTERS; ++c) {
+        if (fds[c] >= 0) close(fds[c]);
+        fds[c] = -1;
+    }
+    opened = false;
+}
+
+void perf_phase_begin(void) {
+    if (!opened) return;
+    for (int c = 0; c < PERF_NCOUNTERS; ++c) {
+        if (fds[c] < 0) continue;
+        ioctl(fds[c], PERF_EVENT_IOC_RESET, 0);
+        ioctl(fds[c], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+void perf_phase_cancel(void) {
+    if (!opened) return;
+    for (int c = 0; c < PERF_NCOUNTERS; ++c) {
+        if (fds[c] >= 0) ioctl(fds[c], PERF_EVENT_IOC_DISABLE, 0);
+    }
+}
+
+void perf_phase_end(int phase) {
+    if (!opened) return;
+    perf_phase_cancel();
+    for (int c = 0; c < PERF_NCOUNTERS; ++c) {
+        // value, time enabled, time running
+        uint64_t values[3];
+        double count = -1;
+        if (fds[c] >= 0 && read(fds[c], values, sizeof(values)) == sizeof(values)) {
+            count = values[0];
+            if (values[2] > 0 && values[2] < values[1]) {
+                count *= (double) values[1] / values[2];
+            }
+        }
+        phases[phase].count[c] = count;
+    }
+}
+
+#else
+
+int perf_counters_open(void) {
+    return 0;
+}
+
+void perf_counters_close(void) {
+}
+
+void perf_phase_begin(void) {
+}
+
+void perf_phase_cancel(void) {
+}
+
+void perf_phase_end(int phase) {
+    (void) phase;
+}
+
+#endif
+
+bool perf_counters_are_open(void) {
+    return opened;
+}
+
+void perf_phases_get(perf_sample samples[PERF_NPHASES]) {
+    memcpy(samples, phases, sizeof(phases));
+}
+
+// events per thousand instructions, or null
+static void print_per_kilo(FILE* f, const char* name, double events, double instructions) {
+    if (events >= 0 && instructions > 0) {
+        fprintf(f, ", \"%s\": %.4f", name, 1000 * events / instructions);
+    } else {
+        fprintf(f, ", \"%s\": null", name);
+    }
+}
+
+void perf_sample_print_json(FILE* f, const perf_sample* sample) {
+    const double* count = sample->count;
+    fprintf(f, "{");
+    for (int c = 0; c < PERF_NCOUNTERS; ++c) {
+        fprintf(f, "%s\"%s\": ", c == 0 ? "" : ", ", PERF_COUNTER_NAMES[c]);
+        if (count[c] >= 0) {
+            fprintf(f, "%.0f", count[c]);
+        } else {
+            fprintf(f, "null");
+        }
+    }
+    if (count[PERF_INSTRUCTIONS] >= 0 && count[PERF_CYCLES] > 0) {
+        fprintf(f, ", \"ipc\": %.4f", count[PERF_INSTRUCTIONS] / count[PERF_CYCLES]);
+    } else {
+        fprintf(f, ", \"ipc\": null");
+    }
+    print_per_kilo(f, "llc_mpki", count[PERF_LLC_MISSES], count[PERF_INSTRUCTIONS]);
+    print_per_kilo(f, "dtlb_mpki", count[PERF_DTLB_MISSES], count[PERF_INSTRUCTIONS]);
+    print_per_kilo(f, "branch_mpki", count[PERF_BRANCH_MISSES], count[PERF_INSTRUCTIONS]);
+    fprintf(f, "}");
+}
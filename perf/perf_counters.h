@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+
+// Hardware performance counters around the phases of mytricount.
+//
+// perf_counters_open opens the counters with perf_event_open, for the calling
+// thread and every thread it creates afterwards, so it must be called before
+// the OpenMP threads are started (before GrB_init).  mytricount brackets each
+// of its phases with perf_phase_begin and perf_phase_end; these do nothing
+// unless the counters are open.  A counter the kernel or the hardware does
+// not provide (or that perf_event_paranoid forbids) is reported as missing,
+// and the others are still counted.  Since every thread created after the
+// counters are opened is counted too, mytricount does not start its wedge
+// count thread while they are open (see mytricount.c).
+
+enum {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_LLC_MISSES,
+    PERF_DTLB_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_NCOUNTERS
+};
+
+extern const char* PERF_COUNTER_NAMES[PERF_NCOUNTERS];
+
+// the phases of mytricount, in the order of its timer
+enum {
+    PERF_PHASE_MULTIPLY,
+    PERF_PHASE_REDUCE,
+    PERF_PHASE_PREP,
+    PERF_NPHASES
+};
+
+// Counts of one phase.  A count is negative if the counter is not available.
+// When the kernel had to multiplex the counters, the counts are scaled to
+// the whole phase.
+typedef struct {
+    double count[PERF_NCOUNTERS];
+} perf_sample;
+
+// Open the counters.  Returns the number of counters available, 0 if none.
+int perf_counters_open(void);
+
+void perf_counters_close(void);
+
+// true if the counters are open
+bool perf_counters_are_open(void);
+
+// Start counting a phase, if the counters are open
+void perf_phase_begin(void);
+
+// Stop counting and record the counts of the phase, if the counters are open
+void perf_phase_end(int phase);
+
+// Stop counting without recording the phase, on an error path
+void perf_phase_cancel(void);
+
+// Counts of the last run of each phase
+void perf_phases_get(perf_sample samples[PERF_NPHASES]);
+
+// Write the counts as a JSON object, with the instructions per cycle and the
+// misses per thousand instructions; missing counts are null
+void perf_sample_print_json(FILE* f, const perf_sample* sample);
@@ -1,7 +1,7 @@
 from urllib.parse import urlparse
 
-import re
 import os
+import json
 import wget
 import gzip
 import shutil
@@ -18,6 +18,7 @@ METHODS = [
     'Sandia2',
     'SandiaDot',
     'SandiaDot2',
+    'Forward',
 ]
 
 GRAPHS = {
@@ -73,36 +74,27 @@ def create_fullgraph(n):
 
 def init():
     sp.run(f'make', shell=True)
+    sp.run(f'make bench', shell=True)
     for url in list(GRAPHS.values()):
         download_graph(url)
     for n in FULLGRAPH_POWS:
         create_fullgraph(n)
 
 
-def get_time(file_path):
+def test_bench(file_paths, warmup=1, reps=5):
+    res = sp.run(['./tricount_bench', '-w', str(warmup), '-r', str(reps)] + file_paths,
+                 stdout=sp.PIPE, universal_newlines=True)
+
     result = {}
-    content = None
-    with open(file_path, 'r') as f_in:
-        content = f_in.readlines()
-    for method in METHODS:
-        for line in content:
-            if re.fullmatch(f'({method} used time \(in seconds\): )(.*)(\n)', line) is not None:
-                result[method] = re.sub(
-                    f'({method} used time \(in seconds\): )(.*)(\n)', '\g<2>', line)
-    print(result)
+    for record in json.loads(res.stdout)['graphs']:
+        result[record['graph']] = {
+            method: f"{stats['total']['median']:f}"
+            for method, stats in record.get('methods', {}).items()
+            if 'total' in stats
+        }
     return result
 
 
-def test_graph(file_path):
-    results_path = './results/' + os.path.split(file_path)[1]
-
-    res = sp.run(f'./main {file_path} > {results_path}', shell=True)
-
-    print(res)
-
-    return results_path
-
-
 def test_all_fullgraphs(n=FULLGRAPH_POWS[-1]):
     with open('./fullgraph_results.md', 'w') as f_out:
         head = '| N |'
@@ -113,8 +105,11 @@ def test_all_fullgraphs(n=FULLGRAPH_POWS[-1]):
         f_out.write(f'{head}\n')
         f_out.write(f'{grid}\n')
 
-        for n in list(filter(lambda x: x <= n, FULLGRAPH_POWS)):
-            time = get_time(test_graph(f'./input/FullGraph/fullgraph_{n}.txt'))
+        sizes = list(filter(lambda x: x <= n, FULLGRAPH_POWS))
+        times = test_bench([f'./input/FullGraph/fullgraph_{n}.txt' for n in sizes])
+
+        for n in sizes:
+            time = times.get(f'./input/FullGraph/fullgraph_{n}.txt', {})
             res = f'| {n} |'
             for method in METHODS:
                 res += f' {time.get(method)} |'
@@ -131,13 +126,14 @@ def test_all_stanford_graphs(n=-1):
         f_out.write(f'{head}\n')
         f_out.write(f'{grid}\n')
 
-        for g in list(GRAPHS.keys()):
-            print(g, n)
-            if n == 0:
-                break
-            n -= 1
-            time = get_time(test_graph(f'./input/{g}'))
-            print(time)
+        graphs = list(GRAPHS.keys())
+        if n >= 0:
+            graphs = graphs[:n]
+        times = test_bench([f'./input/{g}' for g in graphs])
+
+        for g in graphs:
+            time = times.get(f'./input/{g}', {})
+            print(g, time)
             res = f'| {g} |'
             for method in METHODS:
                 res += f' {time.get(method)} |'